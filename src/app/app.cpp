@@ -409,6 +409,7 @@ void App::applyCommandLineOptions(const CommandLineParser::Options& options, fra
 #ifdef MUE_BUILD_IMAGESEXPORT_MODULE
     imagesExportConfiguration()->setTrimMarginPixelSize(options.exportImage.trimMarginPixelSize);
     imagesExportConfiguration()->setExportPngDpiResolutionOverride(options.exportImage.pngDpiResolution);
+    imagesExportConfiguration()->setExportSvgReuseSymbolsOverride(options.exportImage.svgReuseSymbols);
 #endif
 
 #ifdef MUE_BUILD_VIDEOEXPORT_MODULE
@@ -423,6 +424,7 @@ void App::applyCommandLineOptions(const CommandLineParser::Options& options, fra
     midiImportExportConfiguration()->setMidiImportOperationsFile(options.importMidi.operationsFile);
     guitarProConfiguration()->setLinkedTabStaffCreated(options.guitarPro.linkedTabStaffCreated);
     guitarProConfiguration()->setExperimental(options.guitarPro.experimental);
+    musicXmlConfiguration()->setMusicxmlImportValidationOverride(options.musicXml.validation);
 #endif
 
     if (options.app.revertToFactorySettings) {
@@ -458,6 +460,9 @@ int App::processConverter(const CommandLineParser::ConverterTask& task)
     case CommandLineParser::ConvertType::Batch:
         ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
         break;
+    case CommandLineParser::ConvertType::BatchDaemon:
+        ret = converter()->batchConvertDaemon(stylePath, forceMode);
+        break;
     case CommandLineParser::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
         break;
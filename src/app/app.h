@@ -44,6 +44,7 @@
 #include "importexport/audioexport/iaudioexportconfiguration.h"
 #include "importexport/videoexport/ivideoexportconfiguration.h"
 #include "importexport/guitarpro/iguitarproconfiguration.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
 
 #include "commandlineparser.h"
 
@@ -66,6 +67,7 @@ class App
     INJECT(iex::audioexport::IAudioExportConfiguration, audioExportConfiguration)
     INJECT(iex::videoexport::IVideoExportConfiguration, videoExportConfiguration)
     INJECT(iex::guitarpro::IGuitarProConfiguration, guitarProConfiguration)
+    INJECT(iex::musicxml::IMusicXmlConfiguration, musicXmlConfiguration)
 
 public:
     App();
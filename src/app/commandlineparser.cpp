@@ -82,6 +82,8 @@ void CommandLineParser::init()
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("job-daemon",
+                                          "Process conversion jobs read from stdin, one JSON object per line, until the end of input"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -101,6 +103,8 @@ void CommandLineParser::init()
                                           "Transpose the given score and export the data to a single JSON file, print it to stdout",
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("svg-reuse-symbols",
+                                          "Use with '-o <file>.svg' or '--score-media', write each distinct symbol once and reference it"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
@@ -122,6 +126,7 @@ void CommandLineParser::init()
 
     m_parser.addOption(QCommandLineOption("gp-linked", "create tabulature linked staves for guitar pro"));
     m_parser.addOption(QCommandLineOption("gp-experimental", "experimental features for guitar pro import"));
+    m_parser.addOption(QCommandLineOption("musicxml-no-validation", "skip schema validation of imported MusicXML files"));
 
     //! NOTE Currently only implemented `full` mode
     m_parser.addOption(QCommandLineOption("migration", "Whether to do migration with given mode, `full` - full migration", "mode"));
@@ -218,6 +223,10 @@ void CommandLineParser::parse(int argc, char** argv)
         }
     }
 
+    if (m_parser.isSet("svg-reuse-symbols")) {
+        m_options.exportImage.svgReuseSymbols = true;
+    }
+
     if (m_parser.isSet("M")) {
         m_options.importMidi.operationsFile = fromUserInputPath(m_parser.value("M"));
     }
@@ -295,6 +304,11 @@ void CommandLineParser::parse(int argc, char** argv)
         m_converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
     }
 
+    if (m_parser.isSet("job-daemon")) {
+        m_runMode = IApplication::RunMode::ConsoleApp;
+        m_converterTask.type = ConvertType::BatchDaemon;
+    }
+
     if (m_parser.isSet("score-media")) {
         m_runMode = IApplication::RunMode::ConsoleApp;
         m_converterTask.type = ConvertType::ExportScoreMedia;
@@ -402,6 +416,10 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.guitarPro.experimental = true;
     }
 
+    if (m_parser.isSet("musicxml-no-validation")) {
+        m_options.musicXml.validation = false;
+    }
+
     if (m_runMode == IApplication::RunMode::ConsoleApp) {
         if (m_parser.isSet("migration")) {
             QString val = m_parser.value("migration");
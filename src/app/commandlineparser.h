@@ -58,6 +58,7 @@ public:
         struct {
             std::optional<int> trimMarginPixelSize;
             std::optional<float> pngDpiResolution;
+            std::optional<bool> svgReuseSymbols;
         } exportImage;
 
         struct {
@@ -80,6 +81,10 @@ public:
             std::optional<bool> experimental;
         } guitarPro;
 
+        struct {
+            std::optional<bool> validation;
+        } musicXml;
+
         struct {
             std::optional<bool> revertToFactorySettings;
             std::optional<haw::logger::Level> loggerLevel;
@@ -95,6 +100,7 @@ public:
     enum class ConvertType {
         File,
         Batch,
+        BatchDaemon,
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
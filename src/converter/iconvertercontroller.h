@@ -36,6 +36,7 @@ public:
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
     virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvertDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
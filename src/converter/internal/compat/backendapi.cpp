@@ -22,6 +22,8 @@
 #include "backendapi.h"
 
 #include <stdio.h>
+#include <functional>
+#include <future>
 
 #include <QString>
 #include <QJsonDocument>
@@ -31,10 +33,13 @@
 #include <QRandomGenerator>
 
 #include "io/buffer.h"
+#include "concurrency/parallelfor.h"
 
 #include "engraving/compat/scoreaccess.h"
 #include "engraving/infrastructure/mscwriter.h"
 #include "engraving/dom/excerpt.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/part.h"
 #include "engraving/rw/mscsaver.h"
 
 #include "backendjsonwriter.h"
@@ -79,24 +84,101 @@ Ret BackendApi::exportScoreMedia(const io::path_t& in, const io::path_t& out, co
 
     INotationPtr notation = prj.val->masterNotation()->notation();
 
-    bool result = true;
+    //! NOTE The exports run concurrently against the laid out score, each one into its own json fragment.
+    //! Exports sharing mutable state are in the same group and run one after another:
+    //! the painters switch the score into printing mode and set the global paint state,
+    //! the elements positions and the metadata depend on the repeat list that the MIDI renderer rebuilds.
+    //! The SVG export sets the beats colors on the notes while walking the repeat list, the later exports
+    //! (PDF, MusicXML) write these colors, so it runs first, after the PNG export and before all the others.
+    //! The MusicXML export changes the score in the concert pitch mode (style change and a relayout),
+    //! so it runs alone too, before the concurrent groups. Only the exports that just read the score run concurrently.
+    enum class Group {
+        BeatsColors,
+        MusicXml,
+        Painting,
+        Playback,
+        Other
+    };
+
+    using ExportFunc = std::function<Ret (BackendJsonWriter& jsonWriter, bool addSeparator)>;
+
+    struct MediaExport {
+        Group group = Group::Other;
+        ExportFunc func;
+        QByteArray json;
+        Ret ret;
+    };
+
+    // in the order of the resulting json
+    std::vector<MediaExport> exports {
+        { Group::BeatsColors, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScorePngs(notation, jsonWriter, addSeparator);
+            } },
+        { Group::BeatsColors, [notation, highlightConfigPath](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreSvgs(notation, highlightConfigPath, jsonWriter, addSeparator);
+            } },
+        { Group::Playback, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreElementsPositions(SEGMENTS_POSITIONS_WRITER_NAME, SEGMENTS_POSITIONS_TAG_NAME,
+                                                    notation, jsonWriter, addSeparator);
+            } },
+        { Group::Playback, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreElementsPositions(MEASURES_POSITIONS_WRITER_NAME, MEASURES_POSITIONS_TAG_NAME,
+                                                    notation, jsonWriter, addSeparator);
+            } },
+        { Group::Painting, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScorePdf(notation, jsonWriter, addSeparator);
+            } },
+        { Group::Playback, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreMidi(notation, jsonWriter, addSeparator);
+            } },
+        { Group::MusicXml, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreMusicXML(notation, jsonWriter, addSeparator);
+            } },
+        { Group::Playback, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return exportScoreMetaData(notation, jsonWriter, addSeparator);
+            } },
+        { Group::Other, [notation](BackendJsonWriter& jsonWriter, bool addSeparator) {
+                return devInfo(notation, jsonWriter, addSeparator);
+            } },
+    };
+
+    auto runGroup = [&exports](Group group) {
+        for (size_t i = 0; i < exports.size(); ++i) {
+            MediaExport& mediaExport = exports[i];
+            if (mediaExport.group != group) {
+                continue;
+            }
+
+            QBuffer buffer(&mediaExport.json);
+            BackendJsonWriter jsonWriter(&buffer, false);
+
+            bool addSeparator = i + 1 < exports.size();
+            mediaExport.ret = mediaExport.func(jsonWriter, addSeparator);
+        }
+    };
+
+    runGroup(Group::BeatsColors);
+    runGroup(Group::MusicXml);
+
+    std::future<void> playback = std::async(std::launch::async, runGroup, Group::Playback);
+    std::future<void> other = std::async(std::launch::async, runGroup, Group::Other);
+
+    // the painters stay on this thread, as they did before
+    runGroup(Group::Painting);
+
+    playback.wait();
+    other.wait();
 
     QFile outputFile;
     openOutputFile(outputFile, out);
 
     BackendJsonWriter jsonWriter(&outputFile);
 
-    result &= exportScorePngs(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreSvgs(notation, highlightConfigPath, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreElementsPositions(SEGMENTS_POSITIONS_WRITER_NAME, SEGMENTS_POSITIONS_TAG_NAME,
-                                           notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreElementsPositions(MEASURES_POSITIONS_WRITER_NAME, MEASURES_POSITIONS_TAG_NAME,
-                                           notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScorePdf(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMidi(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMusicXML(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMetaData(notation, jsonWriter, ADD_SEPARATOR);
-    result &= devInfo(notation, jsonWriter);
+    bool result = true;
+    for (const MediaExport& mediaExport : exports) {
+        jsonWriter.addFragment(mediaExport.json);
+        result &= mediaExport.ret.success();
+    }
 
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
@@ -231,7 +313,6 @@ RetVal<project::INotationProjectPtr> BackendApi::openProject(const io::path_t& p
     }
 
     switchToPageView(masterNotation);
-    renderExcerptsContents(masterNotation);
 
     return RetVal<INotationProjectPtr>::make_ok(notationProject);
 }
@@ -294,8 +375,11 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
 
     PageList notationPages = pages(notation);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
+    std::vector<QByteArray> pagesData(notationPages.size());
+    std::vector<Ret> pagesRet(notationPages.size());
+
+    // painting is reentrant, so the pages are rendered and encoded concurrently
+    parallelFor(0, notationPages.size(), [&](size_t i) {
         QByteArray pngData;
         QBuffer pngDevice(&pngData);
         pngDevice.open(QIODevice::ReadWrite);
@@ -305,14 +389,19 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
             { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
         };
 
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
+        pagesRet[i] = pngWriter->write(notation, pngDevice, options);
+        pagesData[i] = pngData.toBase64();
+    });
+
+    bool result = true;
+    for (size_t i = 0; i < notationPages.size(); ++i) {
+        if (!pagesRet[i]) {
+            LOGW() << pagesRet[i].toString();
             result = false;
         }
 
         bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toBase64(), !lastArrayValue);
+        jsonWriter.addValue(pagesData[i], !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -337,8 +426,10 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path_t& h
     PageList notationPages = pages(notation);
     QVariantMap beatsColors = readBeatsColors(highlightConfigPath);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
+    std::vector<QByteArray> pagesData(notationPages.size());
+    std::vector<Ret> pagesRet(notationPages.size());
+
+    auto writePage = [&](size_t i) {
         QByteArray svgData;
         QBuffer svgDevice(&svgData);
         svgDevice.open(QIODevice::ReadWrite);
@@ -349,14 +440,26 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path_t& h
             { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
         };
 
-        Ret writeRet = svgWriter->write(notation, svgDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
+        pagesRet[i] = svgWriter->write(notation, svgDevice, options);
+        pagesData[i] = svgData.toBase64();
+    };
+
+    //! NOTE The first page is written alone, as the writer applies the beats colors to the score;
+    //! the remaining pages don't modify it any more and are rendered concurrently
+    if (!notationPages.empty()) {
+        writePage(0);
+    }
+    parallelFor(1, notationPages.size(), writePage);
+
+    bool result = true;
+    for (size_t i = 0; i < notationPages.size(); ++i) {
+        if (!pagesRet[i]) {
+            LOGW() << pagesRet[i].toString();
             result = false;
         }
 
         bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toBase64(), !lastArrayValue);
+        jsonWriter.addValue(pagesData[i], !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -535,6 +638,9 @@ Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIOD
 
     ExcerptNotationList excerpts = allExcerpts(masterNotation);
 
+    std::vector<mu::engraving::Score*> parts;
+    std::vector<std::string> fileNames;
+
     for (IExcerptNotationPtr excerpt : excerpts) {
         mu::engraving::Score* part = excerpt->notation()->elements()->msScore();
         std::map<String, String> partMetaTags = part->metaTags();
@@ -550,8 +656,36 @@ Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIOD
         QJsonValue partMetaObj = QJsonObject::fromVariantMap(meta);
         partsMetaList << partMetaObj;
 
-        std::string fileName = io::escapeFileName(part->name().toStdString()).toStdString() + ".mscz";
-        QJsonValue partObj(QString::fromLatin1(scorePartJson(part, fileName).val));
+        parts.push_back(part);
+        fileNames.push_back(io::escapeFileName(part->name().toStdString()).toStdString() + ".mscz");
+    }
+
+    //! NOTE The parts are read and laid out above. The deferred excerpts are loaded and the midi mapping
+    //! of the master score is checked here once, so saving a part only reads it and the master score
+    //! and the parts are saved concurrently. The parts that would be laid out again while saving
+    //! (see canSavePartConcurrently) are saved first, one by one, because the layout of the parts
+    //! goes through the command state and the undo stack of the master score
+    masterNotation->masterScore()->loadDeferredExcerpts();
+    masterNotation->masterScore()->checkMidiMapping();
+
+    std::vector<QByteArray> partsData(parts.size());
+    std::vector<size_t> concurrentParts;
+
+    for (size_t i = 0; i < parts.size(); ++i) {
+        if (canSavePartConcurrently(parts[i])) {
+            concurrentParts.push_back(i);
+        } else {
+            partsData[i] = scorePartJson(parts[i], fileNames[i], true, true).val;
+        }
+    }
+
+    parallelFor(0, concurrentParts.size(), [&](size_t i) {
+        const size_t partIdx = concurrentParts[i];
+        partsData[partIdx] = scorePartJson(parts[partIdx], fileNames[partIdx], true, true).val;
+    });
+
+    for (const QByteArray& partData : partsData) {
+        QJsonValue partObj(QString::fromLatin1(partData));
         partsObjList << partObj;
     }
 
@@ -566,18 +700,34 @@ Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIOD
     return ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+bool BackendApi::canSavePartConcurrently(const mu::engraving::Score* part)
+{
+    //! NOTE The thumbnail is painted in the page mode, the part is laid out again if it's in another mode
+    if (part->layoutMode() != LayoutMode::PAGE) {
+        return false;
+    }
+
+    //! NOTE The writer lays out again the parts with multimeasure rests and hidden instruments
+    if (part->style().styleB(Sid::createMultiMeasureRests)) {
+        for (const mu::engraving::Part* p : part->parts()) {
+            if (!p->show()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation, QIODevice& destinationDevice,
                                        const std::string& scoreFileName)
 {
     QJsonObject jsonForPdfs;
     jsonForPdfs["score"] = QString::fromStdString(scoreFileName);
-    QByteArray scoreBin = processWriter(PDF_WRITER_NAME, masterNotation->notation()).val;
-    jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
 
     INotationPtrList notations;
     notations.push_back(masterNotation->notation());
 
-    QJsonArray partsArray;
     QJsonArray partsNamesArray;
 
     ExcerptNotationList excerpts = allExcerpts(masterNotation);
@@ -586,23 +736,35 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
         QJsonValue partNameVal(e->name());
         partsNamesArray.append(partNameVal);
 
-        QByteArray partBin = processWriter(PDF_WRITER_NAME, e->notation()).val;
-        QJsonValue partVal(QString::fromLatin1(partBin));
-        partsArray.append(partVal);
-
         notations.push_back(e->notation());
     }
 
-    jsonForPdfs["parts"] = partsNamesArray;
-    jsonForPdfs["partsBin"] = partsArray;
-
-    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
-
     INotationWriter::Options options {
         { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) }
     };
 
+    //! NOTE The pdf writer already paints the pages of a pdf concurrently,
+    //! so the pdfs themselves are written one after another
+    std::vector<QByteArray> pdfsData;
+    for (const INotationPtr& notation : notations) {
+        pdfsData.push_back(processWriter(PDF_WRITER_NAME, notation).val);
+    }
+
     QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
+
+    jsonForPdfs["scoreBin"] = QString::fromLatin1(pdfsData.front());
+
+    QJsonArray partsArray;
+    for (size_t i = 1; i < pdfsData.size(); ++i) {
+        QJsonValue partVal(QString::fromLatin1(pdfsData[i]));
+        partsArray.append(partVal);
+    }
+
+    jsonForPdfs["parts"] = partsNamesArray;
+    jsonForPdfs["partsBin"] = partsArray;
+
+    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
+
     jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
 
     QJsonDocument jsonDoc(jsonForPdfs);
@@ -631,7 +793,8 @@ Ret BackendApi::doExportScoreTranspose(const INotationPtr notation, BackendJsonW
     return ret;
 }
 
-RetVal<QByteArray> BackendApi::scorePartJson(mu::engraving::Score* score, const std::string& fileName)
+RetVal<QByteArray> BackendApi::scorePartJson(mu::engraving::Score* score, const std::string& fileName, bool midiMappingChecked,
+                                             bool excerptLoaded)
 {
     ByteArray scoreData;
     Buffer buf(&scoreData);
@@ -644,7 +807,7 @@ RetVal<QByteArray> BackendApi::scorePartJson(mu::engraving::Score* score, const
     MscWriter mscWriter(params);
     mscWriter.open();
 
-    bool ok = MscSaver().exportPart(score, mscWriter);
+    bool ok = MscSaver().exportPart(score, mscWriter, midiMappingChecked, excerptLoaded);
     if (!ok) {
         LOGW() << "Error save mscz file";
     }
@@ -764,7 +927,11 @@ void BackendApi::switchToPageView(IMasterNotationPtr masterNotation)
 void BackendApi::renderExcerptsContents(IMasterNotationPtr masterNotation)
 {
     //! NOTE: Due to optimization, only the master score is layouted
-    //!       Let's layout all the scores of the excerpts
+    //!       and the excerpts that are not open are read on demand
+    //!       Let's read and layout all the scores of the excerpts
+    //!       (only the exports of the parts need this, see allExcerpts)
+    masterNotation->masterScore()->loadDeferredExcerpts();
+
     for (IExcerptNotationPtr excerpt : masterNotation->excerpts()) {
         Score* score = excerpt->notation()->elements()->msScore();
         if (!score->autoLayoutEnabled()) {
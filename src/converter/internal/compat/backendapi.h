@@ -86,7 +86,9 @@ private:
                                       const std::string& scoreFileName);
     static Ret doExportScoreTranspose(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
 
-    static RetVal<QByteArray> scorePartJson(mu::engraving::Score* score, const std::string& fileName);
+    static RetVal<QByteArray> scorePartJson(mu::engraving::Score* score, const std::string& fileName, bool midiMappingChecked = false,
+                                            bool excerptLoaded = false);
+    static bool canSavePartConcurrently(const mu::engraving::Score* part);
 
     static RetVal<notation::TransposeOptions> parseTransposeOptions(const std::string& optionsJson);
     static Ret applyTranspose(const notation::INotationPtr notation, const std::string& optionsJson);
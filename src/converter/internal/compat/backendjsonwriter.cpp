@@ -24,16 +24,21 @@
 using namespace mu::converter;
 using namespace mu::io;
 
-BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice)
+BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice, bool wrapInObject)
 {
     m_destinationDevice = destinationDevice;
+    m_wrapInObject = wrapInObject;
     m_destinationDevice->open(QIODevice::WriteOnly);
-    m_destinationDevice->write("{\n");
+    if (m_wrapInObject) {
+        m_destinationDevice->write("{\n");
+    }
 }
 
 BackendJsonWriter::~BackendJsonWriter()
 {
-    m_destinationDevice->write("\n}\n");
+    if (m_wrapInObject) {
+        m_destinationDevice->write("\n}\n");
+    }
     m_destinationDevice->close();
 }
 
@@ -58,6 +63,11 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
     }
 }
 
+void BackendJsonWriter::addFragment(const QByteArray& fragment)
+{
+    m_destinationDevice->write(fragment);
+}
+
 void BackendJsonWriter::openArray()
 {
     m_destinationDevice->write(" [");
@@ -28,17 +28,21 @@ namespace mu::converter {
 class BackendJsonWriter
 {
 public:
-    BackendJsonWriter(QIODevice* destinationDevice);
+    //! NOTE If wrapInObject is false, only the keys and values are written,
+    //! e.g. to prepare a fragment that is added to another writer later with addFragment
+    BackendJsonWriter(QIODevice* destinationDevice, bool wrapInObject = true);
     ~BackendJsonWriter();
 
     void addKey(const char* arrayName);
     void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
+    void addFragment(const QByteArray& fragment);
 
     void openArray();
     void closeArray(bool addSeparator = false);
 
 private:
     QIODevice* m_destinationDevice = nullptr;
+    bool m_wrapInObject = true;
 };
 }
 
@@ -21,14 +21,28 @@
  */
 #include "convertercontroller.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+#include <QCryptographicHash>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
 
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 #include "io/dir.h"
 #include "stringutils.h"
+#include "concurrency/parallelfor.h"
+
+#include "engraving/dom/masterscore.h"
 
 #include "convertercodes.h"
 #include "compat/backendapi.h"
@@ -42,6 +56,38 @@ using namespace mu::notation;
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
+static constexpr size_t MAX_CACHED_PROJECTS = 4;
+
+//! NOTE The log may be written to stdout too (see ConsoleLogDest), so the results of the daemon jobs go to a duplicate
+//! of the original stdout, and stdout itself is redirected to stderr
+static FILE* takeStdoutForResults()
+{
+    std::fflush(stdout);
+
+#ifdef Q_OS_WIN
+    const int resultsFd = _dup(_fileno(stdout));
+    _dup2(_fileno(stderr), _fileno(stdout));
+    return _fdopen(resultsFd, "w");
+#else
+    const int resultsFd = dup(fileno(stdout));
+    dup2(fileno(stderr), fileno(stdout));
+    return fdopen(resultsFd, "w");
+#endif
+}
+
+static QByteArray fileHash(const mu::io::path_t& path)
+{
+    QFile file(path.toQString());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+
+    return hash.result();
+}
+
 mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC;
@@ -64,28 +110,126 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
     return ret;
 }
 
-mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+//! NOTE Reads the jobs from stdin, one JSON object per line (in the format of the batch job file items),
+//! until the end of the input, and prints the result of each job to stdout as a JSON line.
+//! The process and the recently opened projects are kept between the jobs
+mu::Ret ConverterController::batchConvertDaemon(const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC;
 
-    LOGI() << "in: " << in << ", out: " << out;
+    FILE* results = takeStdoutForResults();
+    IF_ASSERT_FAILED(results) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    m_useProjectsCache = true;
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        mu::strings::trim(line);
+        if (line.empty()) {
+            continue;
+        }
+
+        QJsonObject result;
+
+        QJsonParseError err;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+        if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+            result["success"] = false;
+            result["error"] = err.errorString();
+        } else {
+            Job job = parseJob(doc.object());
+            result["in"] = job.in.toQString();
+            result["out"] = job.out.toQString();
+
+            Ret ret = (job.in.empty() || job.out.empty()) ? make_ret(Err::BatchJobFileFailedParse)
+                      : fileConvert(job.in, job.out, stylePath, forceMode);
+            result["success"] = ret.success();
+            if (!ret) {
+                LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+                result["error"] = QString::fromStdString(ret.toString());
+            }
+        }
+
+        const QByteArray resultLine = QJsonDocument(result).toJson(QJsonDocument::Compact) + '\n';
+        std::fwrite(resultLine.constData(), 1, static_cast<size_t>(resultLine.size()), results);
+        std::fflush(results);
+    }
+
+    m_useProjectsCache = false;
+    m_projectsCache.clear();
+
+    std::fclose(results);
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::RetVal<INotationProjectPtr> ConverterController::openProject(const io::path_t& in, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    //! NOTE The modification time is too coarse to notice a file rewritten within the same second, so the content is compared
+    const QByteArray hash = m_useProjectsCache ? fileHash(in) : QByteArray();
+
+    for (auto it = m_projectsCache.begin(); it != m_projectsCache.end(); ++it) {
+        if (it->path != in || it->stylePath != stylePath || it->forceMode != forceMode) {
+            continue;
+        }
+
+        if (!hash.isEmpty() && it->fileHash == hash) {
+            m_projectsCache.splice(m_projectsCache.begin(), m_projectsCache, it);
+            return RetVal<INotationProjectPtr>::make_ok(m_projectsCache.front().project);
+        }
+
+        // the file is changed
+        m_projectsCache.erase(it);
+        break;
+    }
+
     auto notationProject = notationCreator()->newProject();
     IF_ASSERT_FAILED(notationProject) {
         return make_ret(Err::UnknownError);
     }
 
+    Ret ret = notationProject->load(in, stylePath, forceMode);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    if (m_useProjectsCache && !hash.isEmpty()) {
+        const ViewMode viewMode = notationProject->masterNotation()->notation()->viewMode();
+
+        m_projectsCache.push_front(CachedProject { in, hash, stylePath, forceMode, viewMode, notationProject });
+        if (m_projectsCache.size() > MAX_CACHED_PROJECTS) {
+            m_projectsCache.pop_back();
+        }
+    }
+
+    return RetVal<INotationProjectPtr>::make_ok(notationProject);
+}
+
+mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    LOGI() << "in: " << in << ", out: " << out;
+
     std::string suffix = io::suffix(out);
     auto writer = writers()->writer(suffix);
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
-    Ret ret = notationProject->load(in, stylePath, forceMode);
-    if (!ret) {
-        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
-        return make_ret(Err::InFileFailedLoad);
+    RetVal<INotationProjectPtr> project = openProject(in, stylePath, forceMode);
+    if (!project.ret) {
+        return project.ret;
     }
 
+    INotationProjectPtr notationProject = project.val;
+    Ret ret = make_ret(Ret::Code::Ok);
+
     globalContext()->setCurrentProject(notationProject);
 
     if (isConvertPageByPage(suffix)) {
@@ -96,7 +240,33 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
 
     globalContext()->setCurrentProject(nullptr);
 
-    return make_ret(Ret::Code::Ok);
+    resetCachedProject(notationProject);
+
+    return ret;
+}
+
+//! NOTE Some writers change the notation they write (e.g. the video writer sets the page view mode),
+//! the next job must get the project as it was loaded
+void ConverterController::resetCachedProject(const INotationProjectPtr& project)
+{
+    auto it = std::find_if(m_projectsCache.begin(), m_projectsCache.end(), [&project](const CachedProject& cached) {
+        return cached.project == project;
+    });
+
+    if (it == m_projectsCache.end()) {
+        return;
+    }
+
+    // the score itself is changed, it can't be restored
+    if (project->needSave().val) {
+        m_projectsCache.erase(it);
+        return;
+    }
+
+    INotationPtr notation = project->masterNotation()->notation();
+    if (notation->viewMode() != it->viewMode) {
+        notation->setViewMode(it->viewMode);
+    }
 }
 
 mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const mu::io::path_t& out, const mu::io::path_t& stylePath,
@@ -129,7 +299,7 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const m
         ret = make_ret(Ret::Code::NotSupported);
     }
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const io::path_t& batchJobFile) const
@@ -153,17 +323,8 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
 
     QJsonArray arr = doc.array();
 
-    auto correctUserInputPath = [](const QString& path) -> QString {
-        return io::Dir::fromNativeSeparators(path).toQString();
-    };
-
     for (const QJsonValue v : arr) {
-        QJsonObject obj = v.toObject();
-
-        Job job;
-        job.in = correctUserInputPath(obj["in"].toString());
-        job.out = correctUserInputPath(obj["out"].toString());
-
+        Job job = parseJob(v.toObject());
         if (!job.in.empty() && !job.out.empty()) {
             rv.val.push_back(std::move(job));
         }
@@ -173,6 +334,19 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     return rv;
 }
 
+ConverterController::Job ConverterController::parseJob(const QJsonObject& obj) const
+{
+    auto correctUserInputPath = [](const QString& path) -> QString {
+        return io::Dir::fromNativeSeparators(path).toQString();
+    };
+
+    Job job;
+    job.in = correctUserInputPath(obj["in"].toString());
+    job.out = correctUserInputPath(obj["out"].toString());
+
+    return job;
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
@@ -186,13 +360,22 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
+    const size_t pageCount = notation->elements()->pages().size();
+    std::vector<Ret> pagesRet(pageCount, make_ret(Ret::Code::Ok));
+
+    //! NOTE Painting is reentrant, so the pages are written concurrently.
+    //! The repeat list is built lazily on the first read (the SVG writer reads it), so it is built here first.
+    //! The pages are written without beats colors, so the writers don't change the score
+    notation->elements()->msScore()->repeatList();
+
+    parallelFor(0, pageCount, [&](size_t i) {
         const QString filePath
             = io::path_t(io::dirpath(out) + "/" + io::completeBasename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
         QFile file(filePath);
         if (!file.open(QFile::WriteOnly)) {
-            return make_ret(Err::OutFileFailedOpen);
+            pagesRet[i] = make_ret(Err::OutFileFailedOpen);
+            return;
         }
 
         INotationWriter::Options options {
@@ -204,10 +387,17 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
         Ret ret = writer->write(notation, file, options);
         if (!ret) {
             LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
+            pagesRet[i] = make_ret(Err::OutFileFailedWrite);
+            return;
         }
 
         file.close();
+    });
+
+    for (const Ret& ret : pagesRet) {
+        if (!ret) {
+            return ret;
+        }
     }
 
     return make_ret(Ret::Code::Ok);
@@ -237,6 +427,9 @@ mu::Ret ConverterController::convertScorePartsToPdf(INotationWriterPtr writer, I
 {
     TRACEFUNC;
 
+    //! NOTE The excerpts that are not open are read on demand
+    masterNotation->masterScore()->loadDeferredExcerpts();
+
     INotationPtrList notations;
     notations.push_back(masterNotation->notation());
 
@@ -274,6 +467,9 @@ mu::Ret ConverterController::convertScorePartsToPngs(INotationWriterPtr writer,
         return ret;
     }
 
+    //! NOTE The excerpts that are not open are read on demand
+    masterNotation->masterScore()->loadDeferredExcerpts();
+
     INotationPtrList excerpts;
     for (IExcerptNotationPtr e : masterNotation->excerpts()) {
         excerpts.push_back(e->notation());
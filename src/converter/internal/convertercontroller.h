@@ -24,6 +24,10 @@
 
 #include <list>
 
+#include <QByteArray>
+
+class QJsonObject;
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -48,6 +52,7 @@ public:
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
     Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvertDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -77,6 +82,10 @@ private:
     using BatchJob = std::list<Job>;
 
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
+    Job parseJob(const QJsonObject& obj) const;
+
+    RetVal<project::INotationProjectPtr> openProject(const io::path_t& in, const io::path_t& stylePath, bool forceMode);
+    void resetCachedProject(const project::INotationProjectPtr& project);
 
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
@@ -86,6 +95,20 @@ private:
                                const io::path_t& out) const;
     Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const io::path_t& out) const;
+
+    struct CachedProject {
+        io::path_t path;
+        QByteArray fileHash;
+        io::path_t stylePath;
+        bool forceMode = false;
+        notation::ViewMode viewMode = notation::ViewMode::PAGE;
+        project::INotationProjectPtr project;
+    };
+
+    //! NOTE The recently opened projects of the daemon mode, the most recently used first.
+    //! A client often converts the same score to several formats, it is loaded and laid out once
+    std::list<CachedProject> m_projectsCache;
+    bool m_useProjectsCache = false;
 };
 }
 
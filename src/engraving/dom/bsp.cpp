@@ -21,6 +21,7 @@
  */
 
 #include <cmath>
+#include <unordered_set>
 
 #include "bsp.h"
 #include "engravingitem.h"
@@ -68,12 +69,15 @@ public:
     {
         for (auto it = items->begin(); it != items->end(); ++it) {
             EngravingItem* item = *it;
-            if (!item->itemDiscovered) {
-                item->itemDiscovered = true;
+            //! NOTE Don't mark the items themselves, so that the tree can be searched on several threads at once
+            if (m_discovered.insert(item).second) {
                 foundItems.push_front(item);
             }
         }
     }
+
+private:
+    std::unordered_set<const EngravingItem*> m_discovered;
 };
 
 //---------------------------------------------------------
@@ -154,7 +158,6 @@ std::vector<EngravingItem*> BspTree::items(const RectF& rec)
     climbTree(&findVisitor, rec);
     std::vector<EngravingItem*> l;
     for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
         if (e->pageBoundingRect().intersects(rec)) {
             l.push_back(e);
         }
@@ -173,7 +176,6 @@ std::vector<EngravingItem*> BspTree::items(const PointF& pos)
 
     std::vector<EngravingItem*> l;
     for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
         if (e->contains(pos)) {
             l.push_back(e);
         }
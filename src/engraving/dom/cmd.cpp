@@ -106,6 +106,30 @@ static UndoMacro::ChangesInfo changesInfo(const UndoStack* stack)
     return actualMacro->changesInfo();
 }
 
+static void markScoresModified(const UndoCommand* command, MasterScore* masterScore)
+{
+    for (const UndoCommand* child : command->commands()) {
+        std::vector<const EngravingObject*> objects = child->objectItems();
+
+        //! NOTE We don't know which scores are affected by the command,
+        //! so consider them all modified
+        if (objects.empty() && child->commands().empty()) {
+            for (Score* score : masterScore->scoreList()) {
+                score->setModifiedSinceSave(true);
+            }
+            return;
+        }
+
+        for (const EngravingObject* object : objects) {
+            if (object && object->score()) {
+                object->score()->setModifiedSinceSave(true);
+            }
+        }
+
+        markScoresModified(child, masterScore);
+    }
+}
+
 static std::pair<int, int> changedTicksRange(const CmdState& cmdState, const std::vector<const EngravingItem*>& changedItems)
 {
     int startTick = cmdState.startTick().ticks();
@@ -286,6 +310,11 @@ void Score::startCmd()
         LOGD("Score::startCmd(): cmd already active");
         return;
     }
+
+    //! NOTE The command may change the elements linked to the excerpts,
+    //! so the excerpts that haven't been read yet must be read first
+    masterScore()->loadDeferredExcerpts();
+
     undoStack()->beginMacro(this);
 }
 
@@ -306,9 +335,15 @@ void Score::undoRedo(bool undo, EditData* ed)
 
     cmdState().reset();
     if (undo) {
+        if (const UndoMacro* macro = undoStack()->last()) {
+            markScoresModified(macro, masterScore());
+        }
         undoStack()->undo(ed);
     } else {
         undoStack()->redo(ed);
+        if (const UndoMacro* macro = undoStack()->last()) {
+            markScoresModified(macro, masterScore());
+        }
     }
     update(false);
     masterScore()->setPlaylistDirty();    // TODO: flag all individual operations
@@ -364,6 +399,9 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
     LOGD() << "Undo stack current macro child count: " << undoStack()->current()->childCount();
 
     const bool noUndo = undoStack()->current()->empty(); // nothing to undo?
+    if (!rollback) {
+        markScoresModified(undoStack()->current(), masterScore());
+    }
     undoStack()->endMacro(noUndo);
 
     if (dirty()) {
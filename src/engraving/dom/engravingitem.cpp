@@ -98,7 +98,6 @@ EngravingItem::EngravingItem(const EngravingItem& e)
     m_z          = e.m_z;
     m_color      = e.m_color;
     m_minDistance = e.m_minDistance;
-    itemDiscovered = false;
 
     m_accessibleEnabled = e.m_accessibleEnabled;
 }
@@ -606,11 +605,6 @@ mu::draw::Color EngravingItem::curColor(bool isVisible) const
 
 mu::draw::Color EngravingItem::curColor(bool isVisible, Color normalColor) const
 {
-    // the default element color is always interpreted as black in printing
-    if (score() && score()->printing()) {
-        return (normalColor == engravingConfiguration()->defaultColor()) ? Color::BLACK : normalColor;
-    }
-
     if (flag(ElementFlag::DROP_TARGET)) {
         return engravingConfiguration()->highlightSelectionColor(track() == mu::nidx ? 0 : voice());
     }
@@ -635,6 +629,16 @@ mu::draw::Color EngravingItem::curColor(bool isVisible, Color normalColor) const
     return normalColor;
 }
 
+//---------------------------------------------------------
+//   printingColor
+//    the default element color is always interpreted as black in printing
+//---------------------------------------------------------
+
+mu::draw::Color EngravingItem::printingColor(Color normalColor) const
+{
+    return (normalColor == engravingConfiguration()->defaultColor()) ? Color::BLACK : normalColor;
+}
+
 //---------------------------------------------------------
 //   pagePos
 //    return position in canvas coordinates
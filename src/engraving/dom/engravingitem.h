@@ -348,6 +348,7 @@ public:
     mu::draw::Color curColor() const;
     mu::draw::Color curColor(bool isVisible) const;
     mu::draw::Color curColor(bool isVisible, mu::draw::Color normalColor) const;
+    mu::draw::Color printingColor(mu::draw::Color normalColor) const;
     virtual void setColor(const mu::draw::Color& c) { m_color = c; }
 
     void undoSetColor(const mu::draw::Color& c);
@@ -384,8 +385,6 @@ public:
  */
     virtual bool mousePress(EditData&) { return false; }
 
-    mutable bool itemDiscovered      { false };       ///< helper flag for bsp
-
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
     virtual void reset() override;           // reset all properties & position to default
@@ -190,9 +190,23 @@ size_t Excerpt::nstaves() const
 
 bool Excerpt::isEmpty() const
 {
+    if (isDeferred()) {
+        return false;
+    }
+
     return excerptScore() ? excerptScore()->parts().empty() : true;
 }
 
+bool Excerpt::isDeferred() const
+{
+    return m_deferredReader != nullptr;
+}
+
+void Excerpt::setDeferredReader(const DeferredReader& reader)
+{
+    m_deferredReader = reader;
+}
+
 const TracksMap& Excerpt::tracksMapping()
 {
     updateTracksMapping();
@@ -522,6 +536,8 @@ void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
 
 void MasterScore::initExcerpt(Excerpt* excerpt)
 {
+    loadDeferredExcerpt(excerpt);
+
     if (excerpt->inited()) {
         excerpt->excerptScore()->doLayout();
         return;
@@ -582,6 +598,43 @@ void MasterScore::initParts(Excerpt* excerpt)
     }
 }
 
+void MasterScore::loadDeferredExcerpt(Excerpt* excerpt)
+{
+    std::lock_guard lock(m_deferredExcerptsMutex);
+
+    if (!excerpt->isDeferred()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    Excerpt::DeferredReader reader = std::move(excerpt->m_deferredReader);
+    excerpt->m_deferredReader = nullptr;
+
+    Score* score = excerpt->excerptScore();
+
+    //! NOTE Reading doesn't change the excerpt comparing to the saved file
+    const bool modifiedSinceSave = score->modifiedSinceSave();
+
+    if (!reader(score)) {
+        LOGE() << "failed to read excerpt: " << excerpt->name();
+    }
+
+    score->linkMeasures(this);
+
+    excerpt->parts().clear();
+    initParts(excerpt);
+
+    score->setModifiedSinceSave(modifiedSinceSave);
+}
+
+void MasterScore::loadDeferredExcerpts()
+{
+    for (Excerpt* excerpt : excerpts()) {
+        loadDeferredExcerpt(excerpt);
+    }
+}
+
 void MasterScore::initEmptyExcerpt(Excerpt* excerpt)
 {
     if (excerpt->inited()) {
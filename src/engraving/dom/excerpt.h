@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_EXCERPT_H
 #define MU_ENGRAVING_EXCERPT_H
 
+#include <functional>
 #include <map>
 
 #include "types/fraction.h"
@@ -73,6 +74,12 @@ public:
     size_t nstaves() const;
     bool isEmpty() const;
 
+    //! NOTE The excerpt score may be read from the file later, on the first demand
+    //! (see MasterScore::loadDeferredExcerpt), until then it has no content
+    using DeferredReader = std::function<bool (Score* excerptScore)>;
+    bool isDeferred() const;
+    void setDeferredReader(const DeferredReader& reader);
+
     const TracksMap& tracksMapping();
     void setTracksMapping(const TracksMap& tracksMapping);
 
@@ -104,6 +111,7 @@ private:
     TracksMap m_tracksMapping;
     bool m_inited = false;
     ID m_initialPartId;
+    DeferredReader m_deferredReader;
 };
 }
 
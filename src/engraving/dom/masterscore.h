@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MASTERSCORE_H
 #define MU_ENGRAVING_MASTERSCORE_H
 
+#include <mutex>
+
 #include "infrastructure/ifileinfoprovider.h"
 
 #include "instrument.h"
@@ -82,6 +84,9 @@ class MasterScore : public Score
     bool _expandRepeats = true;
     bool _playlistDirty = true;
     std::vector<Excerpt*> _excerpts;
+    //! NOTE Reading an excerpt links it to the master score, so the deferred excerpts are read one at a time,
+    //! even if several threads need them (e.g. the concurrent part export)
+    std::recursive_mutex m_deferredExcerptsMutex;
     std::vector<PartChannelSettingsLink> _playbackSettingsLinks;
     Score* _playbackScore = nullptr;
     async::Channel<ScoreChangesRange> m_changesRangeChannel;
@@ -206,6 +211,8 @@ public:
     void initAndAddExcerpt(Excerpt*, bool);
     void initExcerpt(Excerpt*);
     void initEmptyExcerpt(Excerpt*);
+    void loadDeferredExcerpt(Excerpt*);
+    void loadDeferredExcerpts();
 
     void setPlaybackScore(Score*);
     Score* playbackScore() { return _playbackScore; }
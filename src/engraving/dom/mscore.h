@@ -225,10 +225,6 @@ public:
     static bool noExcerpts;
     static bool noImages;
 
-    static bool pdfPrinting;
-    static bool svgPrinting;
-    static double pixelRatio;
-
     static double verticalPageGap;
     static double horizontalPageGapEven;
     static double horizontalPageGapOdd;
@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <atomic>
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -51,7 +53,19 @@ static String revision;
 Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), _no(0)
 {
+    invalidateBspTree();
+}
+
+//---------------------------------------------------------
+//   invalidateBspTree
+//---------------------------------------------------------
+
+void Page::invalidateBspTree()
+{
+    static std::atomic<size_t> lastRevision = 0;
+
     bspTreeValid = false;
+    m_layoutRevision = ++lastRevision;
 }
 
 //---------------------------------------------------------
@@ -53,6 +53,7 @@ class Page final : public EngravingItem
 
     BspTree bspTree;
     bool bspTreeValid;
+    size_t m_layoutRevision = 0;
 
     void doRebuildBspTree();
 
@@ -88,7 +89,11 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { bspTreeValid = false; }
+    void invalidateBspTree();
+
+    //! NOTE Changes whenever what is on the page changes (the layout invalidates the BSP tree then),
+    //! and is unique across pages, so that what was painted for a page can be kept until it changes
+    size_t layoutRevision() const { return m_layoutRevision; }
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox() const;                             // tight bounding box, excluding white space
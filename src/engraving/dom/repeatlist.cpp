@@ -201,10 +201,11 @@ int RepeatList::utick2tick(int tick) const
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
+    unsigned cached = idx1.load(std::memory_order_relaxed);
+    unsigned ii = (cached < n) && (tick >= at(cached)->utick) ? cached : 0;
     for (unsigned i = ii; i < n; ++i) {
         if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            idx1 = i;
+            idx1.store(i, std::memory_order_relaxed);
             return tick - (at(i)->utick - at(i)->tick);
         }
     }
@@ -237,7 +238,8 @@ int RepeatList::tick2utick(int tick) const
 double RepeatList::utick2utime(int tick) const
 {
     size_t n = size();
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
+    unsigned cached = idx1.load(std::memory_order_relaxed);
+    unsigned ii = (cached < n) && (tick >= at(cached)->utick) ? cached : 0;
     for (unsigned i = ii; i < n; ++i) {
         if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
             int t     = tick - (at(i)->utick - at(i)->tick);
@@ -255,10 +257,11 @@ double RepeatList::utick2utime(int tick) const
 int RepeatList::utime2utick(double secs) const
 {
     size_t repeatSegmentsCount = size();
-    unsigned ii = (idx2 < repeatSegmentsCount) && (secs >= at(idx2)->utime) ? idx2 : 0;
+    unsigned cached = idx2.load(std::memory_order_relaxed);
+    unsigned ii = (cached < repeatSegmentsCount) && (secs >= at(cached)->utime) ? cached : 0;
     for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
         if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            idx2 = i;
+            idx2.store(i, std::memory_order_relaxed);
             return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
         }
     }
@@ -673,6 +673,7 @@ void Score::dragPosition(const PointF& p, staff_idx_t* rst, Segment** seg, doubl
 void Score::setShowInvisible(bool v)
 {
     m_showInvisible = v;
+    m_modifiedSinceSave = true;
     // BSP tree does not include elements which are not
     // displayed, so we need to refresh it to get
     // invisible elements displayed or properly hidden.
@@ -686,6 +687,7 @@ void Score::setShowInvisible(bool v)
 void Score::setShowUnprintable(bool v)
 {
     m_showUnprintable = v;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -695,6 +697,7 @@ void Score::setShowUnprintable(bool v)
 void Score::setShowFrames(bool v)
 {
     m_showFrames = v;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -704,6 +707,7 @@ void Score::setShowFrames(bool v)
 void Score::setShowPageborders(bool v)
 {
     m_showPageborders = v;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -713,6 +717,7 @@ void Score::setShowPageborders(bool v)
 void Score::setMarkIrregularMeasures(bool v)
 {
     m_markIrregularMeasures = v;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -759,6 +764,7 @@ bool Score::isOpen() const
 void Score::setIsOpen(bool open)
 {
     m_isOpen = open;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -1955,6 +1961,7 @@ String Score::metaTag(const String& s) const
 void Score::setMetaTag(const String& tag, const String& val)
 {
     m_metaTags.insert_or_assign(tag, val);
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
@@ -1965,6 +1972,7 @@ void Score::setSynthesizerState(const SynthesizerState& s)
 {
     // TODO: make undoable
     m_synthesizerState = s;
+    m_modifiedSinceSave = true;
 }
 
 //---------------------------------------------------------
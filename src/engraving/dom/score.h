@@ -28,6 +28,7 @@
  Definition of Score class.
 */
 
+#include <atomic>
 #include <set>
 #include <memory>
 
@@ -584,8 +585,13 @@ public:
     void setFileDivision(int t) { m_fileDivision = t; }
 
     bool dirty() const;
+    //! NOTE Used for incremental saving: false if the score is the same as in the saved file
+    bool modifiedSinceSave() const { return m_modifiedSinceSave; }
+    void setModifiedSinceSave(bool v) { m_modifiedSinceSave = v; }
     bool savedCapture() const { return m_savedCapture; }
     void setSavedCapture(bool v) { m_savedCapture = v; }
+    //! NOTE The printing mode of the last paint, for the layout and the interaction.
+    //! The paint itself reads the printing mode from its painter.
     bool printing() const { return m_printing; }
     void setPrinting(bool val) { m_printing = val; }
     virtual bool playlistDirty() const;
@@ -1059,8 +1065,9 @@ private:
     bool m_showPageborders = false;
     bool m_markIrregularMeasures = true;
     bool m_showInstrumentNames = true;
-    bool m_printing = false;                // True if we are drawing to a printer
+    std::atomic<bool> m_printing = false;   // True if we are drawing to a printer
     bool m_savedCapture = false;            // True if we saved an image capture
+    bool m_modifiedSinceSave = true;
 
     ScoreOrder m_scoreOrder;                 // used for score ordering
     bool m_resetAutoplace = false;
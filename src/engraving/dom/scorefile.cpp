@@ -85,19 +85,15 @@ std::shared_ptr<mu::draw::Pixmap> Score::createThumbnail()
 
     auto pixmap = imageProvider()->createPixmap(w, h, dpm, configuration()->thumbnailBackgroundColor());
 
-    double pr = MScore::pixelRatio;
-    MScore::pixelRatio = 1.0;
-
     auto painterProvider = imageProvider()->painterForImage(pixmap);
     mu::draw::Painter p(painterProvider, "thumbnail");
+    p.setPixelRatio(1.0);
 
     p.setAntialiasing(true);
     p.scale(mag, mag);
     print(&p, 0);
     p.endDraw();
 
-    MScore::pixelRatio = pr;
-
     if (layoutMode() != mode) {
         setLayoutMode(mode);
         doLayout();
@@ -161,8 +157,8 @@ bool Score::saveStyle(const String& name)
 
 void Score::print(mu::draw::Painter* painter, int pageNo)
 {
-    m_printing  = true;
-    MScore::pdfPrinting = true;
+    m_printing = true;
+    painter->setIsPrinting(true);
     Page* page = pages().at(pageNo);
     RectF fr  = page->abbox();
 
@@ -177,7 +173,7 @@ void Score::print(mu::draw::Painter* painter, int pageNo)
         EngravingItem::renderer()->drawItem(e, painter);
         painter->restore();
     }
-    MScore::pdfPrinting = false;
+    painter->setIsPrinting(false);
     m_printing = false;
 }
 }
@@ -22,6 +22,8 @@
 
 #include "sig.h"
 
+#include <algorithm>
+
 #include "log.h"
 
 using namespace mu;
@@ -286,6 +288,29 @@ void TimeSigMap::normalize()
         tick = i->first;
         tm   = ticks_measure(e.timesig());
     }
+
+    _indexBars.clear();
+    _indexTicks.clear();
+    _indexTicksPerBeat.clear();
+    _indexTicksPerMeasure.clear();
+
+    for (auto i = begin(); i != end(); ++i) {
+        const int ticksB = ticks_beat(i->second.timesig().denominator());
+        _indexBars.push_back(i->second.bar());
+        _indexTicks.push_back(i->first);
+        _indexTicksPerBeat.push_back(ticksB);
+        _indexTicksPerMeasure.push_back(ticksB * i->second.timesig().numerator());
+    }
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void TimeSigMap::clear()
+{
+    std::map<int, SigEvent>::clear();
+    normalize();
 }
 
 //---------------------------------------------------------
@@ -367,24 +392,16 @@ int TimeSigMap::bar2tick(int bar, int beat) const
 {
     // bar - index of current bar (terminology: bar == measure)
     // beat - index of beat in current bar
-    auto e = begin();
-
-    for (; e != end(); ++e) {
-        if (bar < e->second.bar()) {
-            break;
-        }
-    }
-    if (empty() || e == begin()) {
+    const size_t next = std::upper_bound(_indexBars.cbegin(), _indexBars.cend(), bar) - _indexBars.cbegin();
+    if (empty() || next == 0) {
         LOGD("TimeSigMap::bar2tick(): not found(%d,%d) not found", bar, beat);
         if (empty()) {
             LOGD("   list is empty");
         }
         return 0;
     }
-    --e;   // current TimeSigMap value
-    int ticksB = ticks_beat(e->second.timesig().denominator());   // ticks per beat
-    int ticksM = ticksB * e->second.timesig().numerator();        // bar length in ticks
-    return e->first + (bar - e->second.bar()) * ticksM + ticksB * beat;
+    const size_t i = next - 1;   // current TimeSigMap value
+    return _indexTicks[i] + (bar - _indexBars[i]) * _indexTicksPerMeasure[i] + _indexTicksPerBeat[i] * beat;
 }
 
 //---------------------------------------------------------
@@ -24,6 +24,7 @@
 #define __AL_SIG_H__
 
 #include <map>
+#include <vector>
 #include <cassert>
 
 #include "global/allocator.h"
@@ -149,6 +150,7 @@ public:
     void del(int tick);
 
     void clearRange(int tick1, int tick2);
+    void clear();
 
     void dump() const;
 
@@ -165,6 +167,13 @@ public:
     int rasterStep(unsigned tick, int raster) const;
 
     void normalize();
+
+private:
+    // bars, ticks and lengths of the map entries for bar2tick, rebuilt in normalize()
+    std::vector<int> _indexBars;
+    std::vector<int> _indexTicks;
+    std::vector<int> _indexTicksPerBeat;
+    std::vector<int> _indexTicksPerMeasure;
 };
 } // namespace mu::engraving
 #endif
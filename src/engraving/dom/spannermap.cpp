@@ -62,19 +62,25 @@ void SpannerMap::update() const
 
 const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
+    findContained(start, stop, results, excludeCollisions);
+    return results;
+}
+
+void SpannerMap::findContained(int start, int stop, IntervalList& result, bool excludeCollisions) const
+{
+    updateIfDirty();
+
+    result.clear();
 
-    results.clear();
+    auto collect = [&result](const interval_tree::Interval<Spanner*>& interval) {
+        result.push_back(interval);
+    };
 
     if (excludeCollisions) {
-        results = collisionFreeTree.findContained(start, stop);
+        collisionFreeTree.visit_contained(start, stop, collect);
     } else {
-        results = tree.findContained(start, stop);
+        tree.visit_contained(start, stop, collect);
     }
-
-    return results;
 }
 
 //---------------------------------------------------------
@@ -83,19 +89,25 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
+    findOverlapping(start, stop, results, excludeCollisions);
+    return results;
+}
+
+void SpannerMap::findOverlapping(int start, int stop, IntervalList& result, bool excludeCollisions) const
+{
+    updateIfDirty();
+
+    result.clear();
 
-    results.clear();
+    auto collect = [&result](const interval_tree::Interval<Spanner*>& interval) {
+        result.push_back(interval);
+    };
 
     if (excludeCollisions) {
-        results = collisionFreeTree.findOverlapping(start, stop);
+        collisionFreeTree.visit_overlapping(start, stop, collect);
     } else {
-        results = tree.findOverlapping(start, stop);
+        tree.visit_overlapping(start, stop, collect);
     }
-
-    return results;
 }
 
 void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const
@@ -51,6 +51,12 @@ public:
 
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
     const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+
+    //! NOTE The variants above reuse one internal buffer, so they must not be called concurrently.
+    //! These ones fill the caller's buffer instead and may be called from several threads
+    //! while the score doesn't change (the tree must be up to date, see updateIfDirty)
+    void findContained(int start, int stop, IntervalList& result, bool excludeCollisions = false) const;
+    void findOverlapping(int start, int stop, IntervalList& result, bool excludeCollisions = false) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -64,6 +70,7 @@ public:
     void clear() { std::multimap<int, Spanner*>::clear(); dirty = true; }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
+    void updateIfDirty() const { if (dirty) { update(); } }
     void setDirty() const { dirty = true; }     // must be called if a spanner changes start/length
 #ifndef NDEBUG
     void dump() const;
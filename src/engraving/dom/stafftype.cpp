@@ -703,7 +703,7 @@ void StaffType::drawInputStringMarks(mu::draw::Painter* p, int string, voice_idx
     // draw the text, if any
     if (!text.isEmpty()) {
         mu::draw::Font f = fretFont();
-        f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * p->pixelRatio());
         p->setFont(f);
         p->drawText(PointF(rect.left(), rect.top() + lineDist), text);
     }
@@ -22,6 +22,7 @@
 
 #include "tempo.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "log.h"
@@ -129,6 +130,34 @@ void TempoMap::normalize()
         tempo = e->second.tempo.val;
     }
     ++_tempoSN;
+    rebuildIndex();
+}
+
+//---------------------------------------------------------
+//   rebuildIndex
+//---------------------------------------------------------
+
+void TempoMap::rebuildIndex()
+{
+    _indexTicks.clear();
+    _indexTimes.clear();
+    _indexPauses.clear();
+    _indexTempos.clear();
+    _indexTicksPerSecond.clear();
+
+    _indexTicks.reserve(size());
+    _indexTimes.reserve(size());
+    _indexPauses.reserve(size());
+    _indexTempos.reserve(size());
+    _indexTicksPerSecond.reserve(size());
+
+    for (auto e = begin(); e != end(); ++e) {
+        _indexTicks.push_back(e->first);
+        _indexTimes.push_back(e->second.time);
+        _indexPauses.push_back(e->second.pause);
+        _indexTempos.push_back(e->second.tempo.val);
+        _indexTicksPerSecond.push_back(Constants::DIVISION * e->second.tempo.val * _tempoMultiplier.val);
+    }
 }
 
 //---------------------------------------------------------
@@ -152,6 +181,7 @@ void TempoMap::clear()
 {
     std::map<int, TEvent>::clear();
     ++_tempoSN;
+    rebuildIndex();
 }
 
 //---------------------------------------------------------
@@ -169,6 +199,7 @@ void TempoMap::clearRange(int tick1, int tick2)
     }
     erase(first, last);
     ++_tempoSN;
+    rebuildIndex();
 }
 
 //---------------------------------------------------------
@@ -274,45 +305,68 @@ int TempoMap::time2tick(double time, int t, int* sn) const
     return (*sn == _tempoSN) ? t : time2tick(time, sn);
 }
 
+//---------------------------------------------------------
+//   indexTime
+//    next - index of the first tempo event after tick
+//---------------------------------------------------------
+
+double TempoMap::indexTime(size_t next, int tick) const
+{
+    if (next == 0) {
+        return double(tick) / (Constants::DIVISION * 2.0 * _tempoMultiplier.val);
+    }
+
+    const size_t i = next - 1;
+    return _indexTimes[i] + double(tick - _indexTicks[i]) / _indexTicksPerSecond[i];
+}
+
 //---------------------------------------------------------
 //   tick2time
 //---------------------------------------------------------
 
 double TempoMap::tick2time(int tick, int* sn) const
 {
-    double time  = 0.0;
-    double delta = double(tick);
-    BeatsPerSecond tempo = 2.0;
-
-    if (!empty()) {
-        int ptick  = 0;
-        auto e = lower_bound(tick);
-        if (e == end()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        } else if (e->first == tick) {
-            ptick = tick;
-            tempo = e->second.tempo;
-            time  = e->second.time;
-        } else if (e != begin()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        }
-        delta = double(tick - ptick);
-    } else {
+    if (empty()) {
         LOGD("TempoMap: empty");
     }
     if (sn) {
         *sn = _tempoSN;
     }
-    time += delta / (Constants::DIVISION * tempo.val * _tempoMultiplier.val);
-    return time;
+
+    const size_t next = std::upper_bound(_indexTicks.cbegin(), _indexTicks.cend(), tick) - _indexTicks.cbegin();
+    return indexTime(next, tick);
+}
+
+//---------------------------------------------------------
+//   ticks2times
+//    Converts many ticks at once. For sorted ticks the
+//    tempo events are walked forward instead of searched
+//---------------------------------------------------------
+
+std::vector<double> TempoMap::ticks2times(const std::vector<int>& ticks) const
+{
+    std::vector<double> times;
+    times.reserve(ticks.size());
+
+    size_t next = 0;
+    int prevTick = 0;
+
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        const int tick = ticks[i];
+
+        if (i == 0 || tick < prevTick) {
+            next = std::upper_bound(_indexTicks.cbegin(), _indexTicks.cend(), tick) - _indexTicks.cbegin();
+        } else {
+            while (next < _indexTicks.size() && _indexTicks[next] <= tick) {
+                ++next;
+            }
+        }
+
+        times.push_back(indexTime(next, tick));
+        prevTick = tick;
+    }
+
+    return times;
 }
 
 //---------------------------------------------------------
@@ -322,26 +376,24 @@ double TempoMap::tick2time(int tick, int* sn) const
 int TempoMap::time2tick(double time, int* sn) const
 {
     int tick     = 0;
-    double delta = time;
-    BeatsPerSecond tempo = _tempo;
+    double delta = 0.0;
+    double tempo = 2.0;
+
+    // the first tempo event at or after time, the conversion continues from the previous one
+    const size_t next = std::lower_bound(_indexTimes.cbegin(), _indexTimes.cend(), time) - _indexTimes.cbegin();
+    if (next > 0) {
+        delta = _indexTimes[next - 1];
+        tick  = _indexTicks[next - 1];
+        tempo = _indexTempos[next - 1];
+    }
 
-    delta = 0.0;
-    tempo = 2.0;
-    for (auto e = begin(); e != end(); ++e) {
-        // if in a pause period, wait on previous tick
-        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
-            delta = (time - (e->second.time - e->second.pause) + delta);
-            break;
-        }
-        if (e->second.time >= time) {
-            break;
-        }
-        delta = e->second.time;
-        tick  = e->first;
-        tempo = e->second.tempo;
+    // if in a pause period, wait on previous tick
+    if (next < _indexTimes.size() && time > _indexTimes[next] - _indexPauses[next]) {
+        delta = (time - (_indexTimes[next] - _indexPauses[next]) + delta);
     }
+
     delta = time - delta;
-    tick += lrint(delta * _tempoMultiplier.val * Constants::DIVISION * tempo.val);
+    tick += lrint(delta * _tempoMultiplier.val * Constants::DIVISION * tempo);
     if (sn) {
         *sn = _tempoSN;
     }
@@ -24,6 +24,7 @@
 #define __AL_TEMPO_H__
 
 #include <map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "global/async/notification.h"
@@ -74,9 +75,20 @@ class TempoMap : public std::map<int, TEvent>
     BeatsPerSecond _tempo; // tempo if not using tempo list (beats per second)
     BeatsPerSecond _tempoMultiplier;
 
+    // flattened copy of the map for the tick <-> time conversions,
+    // rebuilt on every change and searched with binary search
+    std::vector<int> _indexTicks;
+    std::vector<double> _indexTimes;
+    std::vector<double> _indexPauses;
+    std::vector<double> _indexTempos;
+    std::vector<double> _indexTicksPerSecond;
+
     void normalize();
+    void rebuildIndex();
     void del(int tick);
 
+    double indexTime(size_t next, int tick) const;
+
 public:
     TempoMap();
     void clear();
@@ -87,6 +99,7 @@ public:
     BeatsPerSecond tempo(int tick) const;
 
     double tick2time(int tick, int* sn = 0) const;
+    std::vector<double> ticks2times(const std::vector<int>& ticks) const;
     double tick2timeLC(int tick, int* sn) const;
     double tick2time(int tick, double time, int* sn) const;
     int time2tick(double time, int* sn = 0) const;
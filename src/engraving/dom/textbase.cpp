@@ -815,7 +815,7 @@ bool TextFragment::operator ==(const TextFragment& f) const
 void TextFragment::draw(mu::draw::Painter* p, const TextBase* t) const
 {
     mu::draw::Font f(font(t));
-    f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+    f.setPointSizeF(f.pointSizeF() * p->pixelRatio());
 #ifndef Q_OS_MACOS
     TextBase::drawTextWorkaround(p, f, pos, text);
 #else
@@ -830,8 +830,9 @@ void TextFragment::draw(mu::draw::Painter* p, const TextBase* t) const
 
 void TextBase::drawTextWorkaround(mu::draw::Painter* p, mu::draw::Font& f, const mu::PointF& pos, const String& text)
 {
-    double mm = p->worldTransform().m11();
-    if (!(MScore::pdfPrinting) && (mm < 1.0) && f.bold() && !(f.underline() || f.strike())) {
+    //! NOTE The workaround is only needed when the text is scaled down, the paint provider checks the scale:
+    //! a recorded page is painted later, at the scale of the view
+    if (!p->isPrinting() && f.bold() && !(f.underline() || f.strike())) {
         p->drawTextWorkaround(f, pos, text);
     } else {
         p->setFont(f);
@@ -140,6 +140,7 @@ MasterScore* MasterScore::unrollRepeats()
     }
 
     // remove excerpts for now (they are re-created after unrolling master score)
+    score->masterScore()->loadDeferredExcerpts();
     std::list<Excerpt*> excerpts;
     for (Excerpt* e : score->excerpts()) {
         excerpts.push_back(new Excerpt(*e, false));
@@ -22,6 +22,7 @@
 #include "mscreader.h"
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
 #include "serialization/zipreader.h"
@@ -192,6 +193,12 @@ ByteArray MscReader::readExcerptFile(const String& name) const
     return fileData(u"Excerpts/" + name + u"/" + fileName);
 }
 
+ZipReader::RawFileData MscReader::readRawExcerptFile(const String& name) const
+{
+    String fileName = name + u".mscx";
+    return readRawFile(u"Excerpts/" + name + u"/" + fileName);
+}
+
 ByteArray MscReader::readChordListFile() const
 {
     if (!fileExists(u"chordlist.xml")) {
@@ -242,6 +249,11 @@ ByteArray MscReader::readViewSettingsJsonFile(const io::path_t& pathPrefix) cons
     return fileData(pathPrefix.toString() + u"viewsettings.json");
 }
 
+ZipReader::RawFileData MscReader::readRawFile(const String& fileName) const
+{
+    return reader()->rawFileData(fileName);
+}
+
 // =======================================================================
 // Readers
 // =======================================================================
@@ -263,7 +275,7 @@ Ret MscReader::ZipFileReader::open(IODevice* device, const path_t& filePath)
             return make_ret(Err::FileNotFound, filePath);
         }
 
-        m_device = new File(filePath);
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -344,6 +356,15 @@ ByteArray MscReader::ZipFileReader::fileData(const String& fileName) const
     return data;
 }
 
+ZipReader::RawFileData MscReader::ZipFileReader::rawFileData(const String& fileName) const
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return ZipReader::RawFileData();
+    }
+
+    return m_zip->rawFileData(fileName.toStdString());
+}
+
 Ret MscReader::DirReader::open(IODevice* device, const path_t& filePath)
 {
     if (device) {
@@ -404,7 +425,7 @@ bool MscReader::DirReader::fileExists(const String& fileName) const
 ByteArray MscReader::DirReader::fileData(const String& fileName) const
 {
     io::path_t filePath = m_rootPath + "/" + fileName;
-    File file(filePath);
+    MappedFile file(filePath);
     if (!file.open(IODevice::ReadOnly)) {
         LOGE() << "failed open file: " << filePath;
         return ByteArray();
@@ -422,7 +443,7 @@ Ret MscReader::XmlFileReader::open(IODevice* device, const path_t& filePath)
             return make_ret(Err::FileNotFound, filePath);
         }
 
-        m_device = new File(filePath);
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -26,12 +26,9 @@
 #include "types/string.h"
 #include "io/path.h"
 #include "io/iodevice.h"
+#include "serialization/zipreader.h"
 #include "mscio.h"
 
-namespace mu {
-class ZipReader;
-}
-
 namespace mu::engraving {
 class MscReader
 {
@@ -62,6 +59,7 @@ public:
     std::vector<String> excerptNames() const;
     ByteArray readExcerptStyleFile(const String& name) const;
     ByteArray readExcerptFile(const String& name) const;
+    ZipReader::RawFileData readRawExcerptFile(const String& name) const;
 
     ByteArray readChordListFile() const;
     ByteArray readThumbnailFile() const;
@@ -73,6 +71,10 @@ public:
     ByteArray readAudioSettingsJsonFile() const;
     ByteArray readViewSettingsJsonFile(const io::path_t& pathPrefix) const;
 
+    //! NOTE Used for incremental saving, returns the file as it is stored in the container,
+    //! i.e. without decompression (supported only for zip)
+    ZipReader::RawFileData readRawFile(const String& fileName) const;
+
 private:
 
     struct IReader {
@@ -88,6 +90,7 @@ private:
         virtual StringList fileList() const = 0;
         virtual bool fileExists(const String& fileName) const = 0;
         virtual ByteArray fileData(const String& fileName) const = 0;
+        virtual ZipReader::RawFileData rawFileData(const String&) const { return ZipReader::RawFileData(); }
     };
 
     struct ZipFileReader : public IReader
@@ -100,6 +103,7 @@ private:
         StringList fileList() const override;
         bool fileExists(const String& fileName) const override;
         ByteArray fileData(const String& fileName) const override;
+        ZipReader::RawFileData rawFileData(const String& fileName) const override;
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -32,6 +32,8 @@
 #include "serialization/zipwriter.h"
 #include "serialization/textstream.h"
 
+#include "mscreader.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -121,6 +123,13 @@ MscWriter::IWriter* MscWriter::writer() const
 
 bool MscWriter::addFileData(const String& fileName, const ByteArray& data)
 {
+    //! NOTE If the file has not changed since the previous version, then we don't compress it again
+    ZipReader::RawFileData previous = previousRawFileData(fileName);
+    if (previous.isSameData(data) && writer()->addRawFileData(fileName, previous)) {
+        m_meta.addFile(fileName);
+        return true;
+    }
+
     if (!writer()->addFileData(fileName, data)) {
         LOGE() << "failed write file: " << fileName;
         return false;
@@ -131,6 +140,31 @@ bool MscWriter::addFileData(const String& fileName, const ByteArray& data)
     return true;
 }
 
+ZipReader::RawFileData MscWriter::previousRawFileData(const String& fileName) const
+{
+    if (!m_params.previousVersion || m_params.mode != MscIoMode::Zip) {
+        return ZipReader::RawFileData();
+    }
+
+    return m_params.previousVersion->readRawFile(fileName);
+}
+
+bool MscWriter::reuseFileData(const String& fileName)
+{
+    ZipReader::RawFileData previous = previousRawFileData(fileName);
+    if (!previous.isValid) {
+        return false;
+    }
+
+    if (!writer()->addRawFileData(fileName, previous)) {
+        return false;
+    }
+
+    m_meta.addFile(fileName);
+
+    return true;
+}
+
 void MscWriter::writeStyleFile(const ByteArray& data)
 {
     addFileData(u"score_style.mss", data);
@@ -160,16 +194,26 @@ void MscWriter::writeScoreFile(const ByteArray& data)
     addFileData(mainFileName(), data);
 }
 
-void MscWriter::addExcerptStyleFile(const String& name, const ByteArray& data)
+String MscWriter::excerptStyleFileName(const String& name)
 {
     String fileName = name + u".mss";
-    addFileData(u"Excerpts/" + name + u"/" + fileName, data);
+    return u"Excerpts/" + name + u"/" + fileName;
 }
 
-void MscWriter::addExcerptFile(const String& name, const ByteArray& data)
+String MscWriter::excerptFileName(const String& name)
 {
     String fileName = name + u".mscx";
-    addFileData(u"Excerpts/" + name + u"/" + fileName, data);
+    return u"Excerpts/" + name + u"/" + fileName;
+}
+
+void MscWriter::addExcerptStyleFile(const String& name, const ByteArray& data)
+{
+    addFileData(excerptStyleFileName(name), data);
+}
+
+void MscWriter::addExcerptFile(const String& name, const ByteArray& data)
+{
+    addFileData(excerptFileName(name), data);
 }
 
 void MscWriter::writeChordListFile(const ByteArray& data)
@@ -202,6 +246,31 @@ void MscWriter::writeViewSettingsJsonFile(const ByteArray& data, const io::path_
     addFileData(pathPrefix.toString() + u"viewsettings.json", data);
 }
 
+bool MscWriter::reuseStyleFile()
+{
+    return reuseFileData(u"score_style.mss");
+}
+
+bool MscWriter::reuseScoreFile()
+{
+    return reuseFileData(mainFileName());
+}
+
+bool MscWriter::reuseExcerptStyleFile(const String& name)
+{
+    return reuseFileData(excerptStyleFileName(name));
+}
+
+bool MscWriter::reuseExcerptFile(const String& name)
+{
+    return reuseFileData(excerptFileName(name));
+}
+
+bool MscWriter::reuseThumbnailFile()
+{
+    return reuseFileData(u"Thumbnails/thumbnail.png");
+}
+
 void MscWriter::writeMeta()
 {
     if (m_meta.isWritten) {
@@ -317,6 +386,21 @@ bool MscWriter::ZipFileWriter::addFileData(const String& fileName, const ByteArr
     return true;
 }
 
+bool MscWriter::ZipFileWriter::addRawFileData(const String& fileName, const ZipReader::RawFileData& raw)
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return false;
+    }
+
+    m_zip->addRawFile(fileName.toStdString(), raw);
+    if (m_zip->hasError()) {
+        LOGE() << "failed write files to zip";
+        return false;
+    }
+
+    return true;
+}
+
 Ret MscWriter::DirWriter::open(io::IODevice* device, const io::path_t& filePath)
 {
     if (device) {
@@ -26,6 +26,7 @@
 #include "types/ret.h"
 #include "io/path.h"
 #include "io/iodevice.h"
+#include "serialization/zipreader.h"
 #include "mscio.h"
 
 namespace mu {
@@ -34,6 +35,7 @@ class TextStream;
 }
 
 namespace mu::engraving {
+class MscReader;
 class MscWriter
 {
 public:
@@ -44,6 +46,10 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE Incremental saving: if set, the files that have not changed
+        //! are copied from the previous version of the container without recompression
+        const MscReader* previousVersion = nullptr;
     };
 
     MscWriter() = default;
@@ -69,6 +75,14 @@ public:
     void writeAudioSettingsJsonFile(const ByteArray& data);
     void writeViewSettingsJsonFile(const ByteArray& data, const io::path_t& pathPrefix = "");
 
+    //! NOTE Copy the file from the previous version of the container as is (without serialization),
+    //! return false if it is not possible, then the file must be written as usual
+    bool reuseStyleFile();
+    bool reuseScoreFile();
+    bool reuseExcerptStyleFile(const String& name);
+    bool reuseExcerptFile(const String& name);
+    bool reuseThumbnailFile();
+
 private:
 
     struct IWriter {
@@ -79,6 +93,7 @@ private:
         virtual bool isOpened() const = 0;
         virtual bool hasError() const = 0;
         virtual bool addFileData(const String& fileName, const ByteArray& data) = 0;
+        virtual bool addRawFileData(const String&, const ZipReader::RawFileData&) { return false; }
     };
 
     struct ZipFileWriter : public IWriter
@@ -89,6 +104,7 @@ private:
         bool isOpened() const override;
         bool hasError() const override;
         bool addFileData(const String& fileName, const ByteArray& data) override;
+        bool addRawFileData(const String& fileName, const ZipReader::RawFileData& raw) override;
 
     private:
         io::IODevice* m_device = nullptr;
@@ -133,11 +149,15 @@ private:
     IWriter* writer() const;
 
     bool addFileData(const String& fileName, const ByteArray& data);
+    bool reuseFileData(const String& fileName);
+    ZipReader::RawFileData previousRawFileData(const String& fileName) const;
 
     void writeMeta();
     void writeContainer(const std::vector<String>& paths);
 
     String mainFileName() const;
+    static String excerptStyleFileName(const String& name);
+    static String excerptFileName(const String& name);
 
     Params m_params;
     mutable IWriter* m_writer = nullptr;
@@ -87,6 +87,11 @@ mu::io::path_t EngravingConfiguration::appDataPath() const
     return globalConfiguration()->appDataPath();
 }
 
+mu::io::path_t EngravingConfiguration::fontMetricsCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/fontmetrics";
+}
+
 mu::io::path_t EngravingConfiguration::defaultStyleFilePath() const
 {
     return settings()->value(DEFAULT_STYLE_FILE_PATH).toPath();
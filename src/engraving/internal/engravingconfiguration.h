@@ -46,6 +46,7 @@ public:
     void init();
 
     io::path_t appDataPath() const override;
+    io::path_t fontMetricsCachePath() const override;
 
     io::path_t defaultStyleFilePath() const override;
     void setDefaultStyleFilePath(const io::path_t& path) override;
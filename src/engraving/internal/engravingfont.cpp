@@ -21,9 +21,12 @@
  */
 #include "engravingfont.h"
 
+#include <cstring>
+
 #include "serialization/json.h"
 #include "io/file.h"
 #include "io/fileinfo.h"
+#include "io/mappedfile.h"
 #include "draw/painter.h"
 #include "types/symnames.h"
 
@@ -94,6 +97,11 @@ void EngravingFont::ensureLoad()
         return;
     }
 
+    std::lock_guard<std::mutex> lock(m_loadMutex);
+    if (m_loaded) {
+        return;
+    }
+
     if (-1 == fontProvider()->addSymbolFont(String::fromStdString(m_family), m_fontPath)) {
         LOGE() << "fatal error: cannot load internal font: " << m_fontPath;
         return;
@@ -105,36 +113,234 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
-    for (size_t id = 0; id < m_symbols.size(); ++id) {
-        Smufl::Code code = Smufl::code(static_cast<SymId>(id));
-        if (!code.isValid()) {
-            continue;
-        }
-        Sym& sym = m_symbols[id];
-        computeMetrics(sym, code);
-    }
-
     File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
     if (!metadataFile.open(IODevice::ReadOnly)) {
         LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
         return;
     }
 
-    std::string error;
-    JsonObject metadataJson = JsonDocument::fromJson(metadataFile.readAll(), &error).rootObject();
-    if (!error.empty()) {
-        LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
-        return;
+    ByteArray metadata = metadataFile.readAll();
+
+    //! NOTE The metrics depend on the font, its metadata and the list of symbols
+    uint64_t fontHash = 14695981039346656037ULL;
+    auto hashData = [&fontHash](const uint8_t* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            fontHash = (fontHash ^ data[i]) * 1099511628211ULL;
+        }
+    };
+
+    File fontFile(m_fontPath);
+    if (fontFile.open(IODevice::ReadOnly)) {
+        ByteArray fontData = fontFile.readAll();
+        hashData(fontData.constData(), fontData.size());
+    }
+    hashData(metadata.constData(), metadata.size());
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        AsciiStringView name = SymNames::nameForSymId(static_cast<SymId>(id));
+        hashData(reinterpret_cast<const uint8_t*>(name.ascii()), name.size());
+    }
+
+    const io::path_t cachePath = metricsCacheFilePath();
+    ByteArray engravingDefaultsJson;
+    if (cachePath.empty() || !readMetricsCache(cachePath, fontHash, engravingDefaultsJson)) {
+        for (size_t id = 0; id < m_symbols.size(); ++id) {
+            Smufl::Code code = Smufl::code(static_cast<SymId>(id));
+            if (!code.isValid()) {
+                continue;
+            }
+            Sym& sym = m_symbols[id];
+            computeMetrics(sym, code);
+        }
+
+        std::string error;
+        JsonObject metadataJson = JsonDocument::fromJson(metadata, &error).rootObject();
+        if (!error.empty()) {
+            LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
+            return;
+        }
+
+        loadGlyphsWithAnchors(metadataJson.value("glyphsWithAnchors").toObject());
+        loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
+        engravingDefaultsJson = JsonDocument(metadataJson.value("engravingDefaults").toObject()).toJson(JsonDocument::Format::Compact);
+
+        if (!cachePath.empty()) {
+            writeMetricsCache(cachePath, fontHash, engravingDefaultsJson);
+        }
     }
 
-    loadGlyphsWithAnchors(metadataJson.value("glyphsWithAnchors").toObject());
     loadComposedGlyphs();
-    loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
-    loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
+    loadEngravingDefaults(JsonDocument::fromJson(engravingDefaultsJson).rootObject());
 
     m_loaded = true;
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+//! NOTE The metrics of the symbols are computed with FreeType and the SMuFL metadata,
+//! that is noticeable at startup. So they are stored in a binary file
+//! and on the next starts this file is mapped and the table is copied as is.
+//! The file is only valid on the machine which wrote it
+
+static constexpr char METRICS_CACHE_MAGIC[4] = { 'M', 'S', 'F', 'M' };
+static constexpr uint32_t METRICS_CACHE_VERSION = 1;
+
+struct MetricsCacheHeader {
+    char magic[4];
+    uint32_t version = 0;
+    uint64_t fontHash = 0;
+    uint32_t symCount = 0;
+    uint32_t anchorCount = 0;
+    uint32_t engravingDefaultsSize = 0;
+    uint32_t reserved = 0;
+};
+
+struct MetricsCacheSym {
+    uint32_t code = 0;
+    uint32_t anchorsBegin = 0;
+    uint32_t anchorsEnd = 0;
+    uint32_t reserved = 0;
+    double bbox[4] = { 0.0, 0.0, 0.0, 0.0 };
+    double advance = 0.0;
+};
+
+struct MetricsCacheAnchor {
+    uint32_t id = 0;
+    uint32_t reserved = 0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+io::path_t EngravingFont::metricsCacheFilePath() const
+{
+    if (!configuration()) {
+        return io::path_t();
+    }
+
+    io::path_t dir = configuration()->fontMetricsCachePath();
+    if (dir.empty()) {
+        return io::path_t();
+    }
+
+    return dir + "/" + m_name.c_str() + ".metrics";
+}
+
+bool EngravingFont::readMetricsCache(const io::path_t& cachePath, uint64_t fontHash, ByteArray& engravingDefaultsJson)
+{
+    MappedFile file(cachePath);
+    if (!file.open(IODevice::ReadOnly)) {
+        return false;
+    }
+
+    const uint8_t* data = file.readData();
+    const size_t size = file.size();
+
+    MetricsCacheHeader header;
+    if (!data || size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, METRICS_CACHE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != METRICS_CACHE_VERSION
+        || header.fontHash != fontHash
+        || header.symCount != m_symbols.size()) {
+        return false;
+    }
+
+    const size_t symsOffset = sizeof(header);
+    const size_t anchorsOffset = symsOffset + header.symCount * sizeof(MetricsCacheSym);
+    const size_t defaultsOffset = anchorsOffset + header.anchorCount * sizeof(MetricsCacheAnchor);
+    if (size != defaultsOffset + header.engravingDefaultsSize) {
+        LOGW() << "corrupted font metrics cache: " << cachePath;
+        return false;
+    }
+
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        MetricsCacheSym cs;
+        std::memcpy(&cs, data + symsOffset + id * sizeof(cs), sizeof(cs));
+        if (cs.anchorsBegin > cs.anchorsEnd || cs.anchorsEnd > header.anchorCount) {
+            LOGW() << "corrupted font metrics cache: " << cachePath;
+            m_symbols.assign(m_symbols.size(), Sym());
+            return false;
+        }
+
+        Sym& sym = m_symbols[id];
+        sym.code = cs.code;
+        sym.bbox = RectF(cs.bbox[0], cs.bbox[1], cs.bbox[2], cs.bbox[3]);
+        sym.advance = cs.advance;
+        sym.smuflAnchors.clear();
+
+        for (uint32_t a = cs.anchorsBegin; a < cs.anchorsEnd; ++a) {
+            MetricsCacheAnchor ca;
+            std::memcpy(&ca, data + anchorsOffset + a * sizeof(ca), sizeof(ca));
+            sym.smuflAnchors[static_cast<SmuflAnchorId>(ca.id)] = PointF(ca.x, ca.y);
+        }
+    }
+
+    engravingDefaultsJson = ByteArray(data + defaultsOffset, header.engravingDefaultsSize);
+
+    return true;
+}
+
+void EngravingFont::writeMetricsCache(const io::path_t& cachePath, uint64_t fontHash, const ByteArray& engravingDefaultsJson) const
+{
+    std::vector<MetricsCacheSym> syms;
+    std::vector<MetricsCacheAnchor> anchors;
+    syms.reserve(m_symbols.size());
+
+    for (const Sym& sym : m_symbols) {
+        MetricsCacheSym cs;
+        cs.code = static_cast<uint32_t>(sym.code);
+        cs.bbox[0] = sym.bbox.x();
+        cs.bbox[1] = sym.bbox.y();
+        cs.bbox[2] = sym.bbox.width();
+        cs.bbox[3] = sym.bbox.height();
+        cs.advance = sym.advance;
+
+        cs.anchorsBegin = static_cast<uint32_t>(anchors.size());
+        for (const auto& p : sym.smuflAnchors) {
+            MetricsCacheAnchor ca;
+            ca.id = static_cast<uint32_t>(p.first);
+            ca.x = p.second.x();
+            ca.y = p.second.y();
+            anchors.push_back(ca);
+        }
+        cs.anchorsEnd = static_cast<uint32_t>(anchors.size());
+
+        syms.push_back(cs);
+    }
+
+    MetricsCacheHeader header;
+    std::memcpy(header.magic, METRICS_CACHE_MAGIC, sizeof(header.magic));
+    header.version = METRICS_CACHE_VERSION;
+    header.fontHash = fontHash;
+    header.symCount = static_cast<uint32_t>(syms.size());
+    header.anchorCount = static_cast<uint32_t>(anchors.size());
+    header.engravingDefaultsSize = static_cast<uint32_t>(engravingDefaultsJson.size());
+
+    ByteArray data;
+    data.reserve(sizeof(header) + syms.size() * sizeof(MetricsCacheSym) + anchors.size() * sizeof(MetricsCacheAnchor)
+                 + engravingDefaultsJson.size());
+    data.push_back(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    data.push_back(reinterpret_cast<const uint8_t*>(syms.data()), syms.size() * sizeof(MetricsCacheSym));
+    data.push_back(reinterpret_cast<const uint8_t*>(anchors.data()), anchors.size() * sizeof(MetricsCacheAnchor));
+    data.push_back(engravingDefaultsJson);
+
+    //! NOTE Written to a temporary file first, so another instance never maps a partially written cache
+    io::path_t tmpPath = cachePath + ".tmp";
+    fileSystem()->makePath(io::FileInfo(cachePath).path());
+    Ret ret = fileSystem()->writeFile(tmpPath, data);
+    if (ret) {
+        ret = fileSystem()->move(tmpPath, cachePath, true);
+    }
+
+    if (!ret) {
+        LOGW() << "failed write font metrics cache: " << cachePath << ", err: " << ret.toString();
+    }
+}
+
 void EngravingFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
 {
     for (const std::string& symName : glyphsWithAnchors.keys()) {
@@ -676,7 +882,7 @@ void EngravingFont::draw(SymId id, Painter* painter, const SizeF& mag, const Poi
     }
 
     painter->save();
-    double size = 20.0 * MScore::pixelRatio;
+    double size = 20.0 * painter->pixelRatio();
     m_font.setPointSizeF(size);
     painter->scale(mag.width(), mag.height());
     painter->setFont(m_font);
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_ENGRAVINGFONT_H
 #define MU_ENGRAVING_ENGRAVINGFONT_H
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 #include "iengravingfont.h"
@@ -29,6 +31,8 @@
 #include "draw/ifontprovider.h"
 #include "draw/types/geometry.h"
 #include "iengravingfontsprovider.h"
+#include "iengravingconfiguration.h"
+#include "io/ifilesystem.h"
 
 #include "io/path.h"
 
@@ -52,6 +56,8 @@ class EngravingFont : public IEngravingFont
 {
     INJECT_STATIC(mu::draw::IFontProvider, fontProvider)
     INJECT_STATIC(IEngravingFontsProvider, engravingFonts)
+    INJECT_STATIC(IEngravingConfiguration, configuration)
+    INJECT_STATIC(io::IFileSystem, fileSystem)
 public:
     EngravingFont(const std::string& name, const std::string& family, const io::path_t& filePath);
     EngravingFont(const EngravingFont& other);
@@ -89,6 +95,7 @@ public:
     void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const override;
     void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const override;
 
+    //! NOTE Thread-safe, after the font is loaded its metrics are immutable
     void ensureLoad();
 
 private:
@@ -120,12 +127,17 @@ private:
     void loadEngravingDefaults(const JsonObject& engravingDefaultsObject);
     void computeMetrics(Sym& sym, const Smufl::Code& code);
 
+    io::path_t metricsCacheFilePath() const;
+    bool readMetricsCache(const io::path_t& cachePath, uint64_t fontHash, ByteArray& engravingDefaultsJson);
+    void writeMetricsCache(const io::path_t& cachePath, uint64_t fontHash, const ByteArray& engravingDefaultsJson) const;
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
     bool useFallbackFont(SymId id) const;
 
-    bool m_loaded = false;
+    std::atomic<bool> m_loaded { false };
+    std::mutex m_loadMutex;
     std::vector<Sym> m_symbols;
     mutable draw::Font m_font;
 
@@ -22,6 +22,10 @@
 
 #include "playbackmodel.h"
 
+#include <atomic>
+#include <future>
+#include <thread>
+
 #include "dom/fret.h"
 #include "dom/instrument.h"
 #include "dom/masterscore.h"
@@ -87,10 +91,18 @@ void PlaybackModel::load(Score* score)
         notifyAboutChanges(oldTracks, trackChanges);
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    const int tickTo = m_score->lastMeasure()->endTick().ticks();
 
-    for (const auto& pair : m_playbackDataMap) {
-        m_trackAdded.send(pair.first);
+    if (m_loadTracksConcurrently) {
+        updateSetupData();
+        updateContext(0, m_score->ntracks());
+        loadEventsConcurrently(0, tickTo);
+    } else {
+        update(0, tickTo, 0, m_score->ntracks());
+
+        for (const auto& pair : m_playbackDataMap) {
+            m_trackAdded.send(pair.first);
+        }
     }
 
     m_dataChanged.notify();
@@ -127,6 +139,16 @@ Notification PlaybackModel::dataChanged() const
     return m_dataChanged;
 }
 
+bool PlaybackModel::isLoadTracksConcurrently() const
+{
+    return m_loadTracksConcurrently;
+}
+
+void PlaybackModel::setLoadTracksConcurrently(const bool isEnabled)
+{
+    m_loadTracksConcurrently = isEnabled;
+}
+
 bool PlaybackModel::isPlayRepeatsEnabled() const
 {
     return m_expandRepeats;
@@ -322,7 +344,7 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
 }
 
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                                   bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges)
+                                   bool isFirstSegmentOfMeasure, TrackEventsMap& result) const
 {
     int segmentStartTick = segment->tick().ticks();
 
@@ -349,12 +371,11 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             continue;
         }
 
+        PlaybackEventsMap& trackEvents = result[trackId];
+
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, trackEvents);
         }
-
-        collectChangesTracks(trackId, trackChanges);
     }
 
     for (const EngravingItem* item : segment->elist()) {
@@ -378,7 +399,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 const MeasureRepeat* measureRepeat = toMeasureRepeat(item);
                 const Measure* currentMeasure = measureRepeat->measure();
 
-                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, result);
 
                 continue;
             } else {
@@ -387,13 +408,13 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 if (currentMeasure->measureRepeatCount(staffIdx) > 0) {
                     const MeasureRepeat* measureRepeat = currentMeasure->measureRepeatElement(staffIdx);
 
-                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, result);
                     continue;
                 }
             }
         }
 
-        const PlaybackContext& ctx = m_playbackCtxMap[trackId];
+        const PlaybackContext& ctx = playbackContext(trackId);
 
         ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
         if (!profile) {
@@ -403,14 +424,12 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
                           ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
-
-        collectChangesTracks(trackId, trackChanges);
+                          result[trackId]);
     }
 }
 
 void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges)
+                                         const staff_idx_t staffIdx, TrackEventsMap& result) const
 {
     if (!measureRepeat || !currentMeasure) {
         return;
@@ -436,11 +455,145 @@ void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const Mea
             continue;
         }
 
-        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, trackChanges);
+        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, result);
         isFirstSegmentOfRepeatedMeasure = false;
     }
 }
 
+void PlaybackModel::renderMeasure(const int tickPositionOffset, const Measure* measure, const int tickFrom, const int tickTo,
+                                  const std::set<staff_idx_t>& staffIdxSet, const bool renderMetronome, TrackEventsMap& result) const
+{
+    int measureStartTick = measure->tick().ticks();
+    int measureEndTick = measure->endTick().ticks();
+
+    bool isFirstSegmentOfMeasure = true;
+
+    for (Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType()) {
+            continue;
+        }
+
+        int segmentStartTick = segment->tick().ticks();
+        int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+
+        if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+            continue;
+        }
+
+        processSegment(tickPositionOffset, segment, staffIdxSet, isFirstSegmentOfMeasure, result);
+        isFirstSegmentOfMeasure = false;
+    }
+
+    if (renderMetronome) {
+        m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset, result[METRONOME_TRACK_ID]);
+    }
+}
+
+void PlaybackModel::appendEvents(TrackEventsMap events, const mpe::timestamp_t timestampOffset, TrackEventsMap& result)
+{
+    for (auto& pair : events) {
+        PlaybackEventsMap& trackEvents = result[pair.first];
+
+        for (auto& eventsPair : pair.second) {
+            PlaybackEventList& eventList = eventsPair.second;
+
+            if (timestampOffset != 0) {
+                for (PlaybackEvent& event : eventList) {
+                    std::visit([timestampOffset](auto& e) { e.shiftTimestamp(timestampOffset); }, event);
+                }
+            }
+
+            PlaybackEventList& trackEventList = trackEvents[eventsPair.first + timestampOffset];
+
+            if (trackEventList.empty()) {
+                trackEventList = std::move(eventList);
+            } else {
+                trackEventList.insert(trackEventList.end(), std::make_move_iterator(eventList.begin()),
+                                      std::make_move_iterator(eventList.end()));
+            }
+        }
+    }
+}
+
+bool PlaybackModel::canRenderOnce(const Measure* measure, const std::set<staff_idx_t>& staffIdxSet) const
+{
+    for (const staff_idx_t staffIdx : staffIdxSet) {
+        //! NOTE The measure repeats refer to the measures before them, whatever the repeat
+        if (measure->measureRepeatCount(staffIdx) > 0) {
+            return false;
+        }
+    }
+
+    for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType()) {
+            continue;
+        }
+
+        //! NOTE The duration of a chord symbol depends on the chord symbols played after it
+        for (const EngravingItem* item : segment->annotations()) {
+            if (item && findChordSymbol(item) && staffIdxSet.find(item->staffIdx()) != staffIdxSet.cend()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool PlaybackModel::isMovable(const TrackEventsMap& events, const mpe::timestamp_t timestampFrom) const
+{
+    //! NOTE The events only move along with the measure if all their articulations start within it,
+    //! e.g. a slur from the measure before a repeat starts elsewhere on each repeat
+    for (const auto& pair : events) {
+        for (const auto& eventsPair : pair.second) {
+            for (const PlaybackEvent& event : eventsPair.second) {
+                const NoteEvent* noteEvent = std::get_if<NoteEvent>(&event);
+                if (!noteEvent) {
+                    continue;
+                }
+
+                for (const auto& articulation : noteEvent->expressionCtx().articulations) {
+                    if (articulation.second.meta.timestamp < timestampFrom) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+PlaybackModel::MeasureContext PlaybackModel::measureContext(const int tickPositionOffset, const Measure* measure,
+                                                            const std::set<staff_idx_t>& staffIdxSet) const
+{
+    MeasureContext result;
+
+    for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType()) {
+            continue;
+        }
+
+        int segmentPositionTick = segment->tick().ticks() + tickPositionOffset;
+
+        for (const EngravingItem* item : segment->elist()) {
+            if (!item || !item->isChordRest() || !item->part()) {
+                continue;
+            }
+
+            if (staffIdxSet.find(item->staffIdx()) == staffIdxSet.cend()) {
+                continue;
+            }
+
+            const PlaybackContext& ctx = playbackContext(idKey(item));
+
+            result.emplace_back(ctx.appliableDynamicLevel(segmentPositionTick), ctx.persistentArticulationType(segmentPositionTick));
+        }
+    }
+
+    return result;
+}
+
 void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                                  ChangedTrackIdSet* trackChanges)
 {
@@ -450,6 +603,113 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
         return staff.isPrimaryStaff(); // skip linked staves
     });
 
+    applyEvents(renderEvents(tickFrom, tickTo, staffToProcessIdxSet, true /*renderMetronome*/), trackChanges);
+}
+
+void PlaybackModel::loadEventsConcurrently(const int tickFrom, const int tickTo)
+{
+    TRACEFUNC;
+
+    //! NOTE The lookup structures the score builds on demand are built here,
+    //! so that the score is only read while the events are rendered
+    repeatList();
+    m_score->spannerMap().updateIfDirty();
+
+    //! NOTE The events of a part don't depend on the other parts once the repeat list and the tempo map are known,
+    //! so every part is rendered on its own. The metronome is rendered apart from the parts
+    std::vector<std::set<staff_idx_t> > jobs;
+    for (const Part* part : m_score->parts()) {
+        std::set<staff_idx_t> staffIdxSet;
+
+        for (const staff_idx_t staffIdx : part->staveIdxList()) {
+            const Staff* staff = m_score->staff(staffIdx);
+            if (staff && staff->isPrimaryStaff()) { // skip linked staves
+                staffIdxSet.insert(staffIdx);
+            }
+        }
+
+        jobs.push_back(std::move(staffIdxSet));
+    }
+
+    const size_t metronomeJobIdx = jobs.size();
+    jobs.emplace_back();
+
+    std::vector<std::promise<TrackEventsMap> > results(jobs.size());
+    std::atomic<size_t> nextJobIdx = 0;
+
+    auto worker = [this, &jobs, &results, &nextJobIdx, metronomeJobIdx, tickFrom, tickTo]() {
+        for (size_t i = nextJobIdx++; i < jobs.size(); i = nextJobIdx++) {
+            //! NOTE A failed job is reported to the main thread, which waits for its result
+            try {
+                results[i].set_value(renderEvents(tickFrom, tickTo, jobs[i], i == metronomeJobIdx));
+            } catch (...) {
+                results[i].set_exception(std::current_exception());
+            }
+        }
+    };
+
+    const size_t threadCount = std::min(jobs.size(), static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+
+    std::vector<std::future<void> > workers;
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+
+    //! NOTE The tracks are published as soon as their part is ready, in the order of the parts,
+    //! so the playback of the first parts may be set up while the next ones are being rendered.
+    //! The setup data of every track is resolved before the rendering, so the tracks map doesn't grow meanwhile
+    InstrumentTrackIdSet addedTracks;
+
+    auto waitWorkers = [&workers]() {
+        for (std::future<void>& w : workers) {
+            w.wait();
+        }
+    };
+
+    try {
+        for (std::promise<TrackEventsMap>& result : results) {
+            ChangedTrackIdSet readyTracks;
+            applyEvents(result.get_future().get(), &readyTracks);
+
+            for (const InstrumentTrackId& trackId : readyTracks) {
+                if (addedTracks.insert(trackId).second) {
+                    m_trackAdded.send(trackId);
+                }
+            }
+        }
+    } catch (...) {
+        //! NOTE The workers use the jobs and the results, so they are done before the error goes further
+        waitWorkers();
+        throw;
+    }
+
+    waitWorkers();
+
+    for (const auto& pair : m_playbackDataMap) {
+        if (addedTracks.find(pair.first) == addedTracks.cend()) {
+            m_trackAdded.send(pair.first);
+        }
+    }
+}
+
+PlaybackModel::TrackEventsMap PlaybackModel::renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet,
+                                                          const bool renderMetronome) const
+{
+    TrackEventsMap result;
+
+    //! NOTE A measure played several times (repeats, jumps) is rendered once, into a template.
+    //! Within a repeat segment the time only moves by the offset of the segment,
+    //! so every other repeat of the measure is the template moved to its position.
+    //! The measure is rendered again where the dynamics or the play techniques it's played with differ
+    std::unordered_map<const Measure*, int> measurePlaybackCount;
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        for (const Measure* measure : repeatSegment->measureList()) {
+            ++measurePlaybackCount[measure];
+        }
+    }
+
+    std::unordered_map<const Measure*, MeasureEventsTemplate> templates;
+
     for (const RepeatSegment* repeatSegment : repeatList()) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         int repeatStartTick = repeatSegment->tick;
@@ -467,29 +727,59 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 continue;
             }
 
-            bool isFirstSegmentOfMeasure = true;
+            bool isWholeMeasure = measureStartTick >= tickFrom && measureEndTick <= tickTo;
 
-            for (Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
-                    continue;
-                }
+            if (!isWholeMeasure || measurePlaybackCount[measure] < 2 || !canRenderOnce(measure, staffIdxSet)) {
+                TrackEventsMap events;
+                renderMeasure(tickPositionOffset, measure, tickFrom, tickTo, staffIdxSet, renderMetronome, events);
+                appendEvents(std::move(events), 0, result);
+                continue;
+            }
 
-                int segmentStartTick = segment->tick().ticks();
-                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+            timestamp_t measureTimestamp = timestampFromTicks(m_score, measureStartTick + tickPositionOffset);
+            MeasureContext context = measureContext(tickPositionOffset, measure, staffIdxSet);
 
-                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
-                    continue;
-                }
+            auto search = templates.find(measure);
+            if (search != templates.cend() && search->second.context == context) {
+                appendEvents(search->second.events, measureTimestamp - search->second.timestamp, result);
+                continue;
+            }
+
+            MeasureEventsTemplate measureTemplate;
+            measureTemplate.timestamp = measureTimestamp;
+            measureTemplate.context = std::move(context);
+            renderMeasure(tickPositionOffset, measure, tickFrom, tickTo, staffIdxSet, renderMetronome, measureTemplate.events);
 
-                processSegment(tickPositionOffset, segment, staffToProcessIdxSet, isFirstSegmentOfMeasure, trackChanges);
-                isFirstSegmentOfMeasure = false;
+            if (!isMovable(measureTemplate.events, measureTimestamp)) {
+                appendEvents(std::move(measureTemplate.events), 0, result);
+                continue;
             }
 
-            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
-            collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
+            appendEvents(measureTemplate.events, 0, result);
+            templates[measure] = std::move(measureTemplate);
         }
     }
+
+    return result;
+}
+
+void PlaybackModel::applyEvents(TrackEventsMap events, ChangedTrackIdSet* trackChanges)
+{
+    for (auto& pair : events) {
+        PlaybackEventsMap& originEvents = m_playbackDataMap[pair.first].originEvents;
+
+        if (originEvents.empty()) {
+            originEvents = std::move(pair.second);
+        } else {
+            for (auto& eventsPair : pair.second) {
+                PlaybackEventList& originEventList = originEvents[eventsPair.first];
+                originEventList.insert(originEventList.end(), std::make_move_iterator(eventsPair.second.begin()),
+                                       std::make_move_iterator(eventsPair.second.end()));
+            }
+        }
+
+        collectChangesTracks(pair.first, trackChanges);
+    }
 }
 
 bool PlaybackModel::hasToReloadTracks(const ScoreChangesRange& changesRange) const
@@ -824,6 +1114,17 @@ InstrumentTrackId PlaybackModel::idKey(const ID& partId, const std::string& inst
     return { partId, instrumentId };
 }
 
+const PlaybackContext& PlaybackModel::playbackContext(const InstrumentTrackId& trackId) const
+{
+    auto search = m_playbackCtxMap.find(trackId);
+    if (search == m_playbackCtxMap.cend()) {
+        static const PlaybackContext empty;
+        return empty;
+    }
+
+    return search->second;
+}
+
 mpe::ArticulationsProfilePtr PlaybackModel::defaultActiculationProfile(const InstrumentTrackId& trackId) const
 {
     auto it = m_playbackDataMap.find(trackId);
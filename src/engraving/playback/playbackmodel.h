@@ -26,6 +26,7 @@
 #include <unordered_map>
 #include <map>
 #include <functional>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -58,6 +59,9 @@ public:
 
     async::Notification dataChanged() const;
 
+    bool isLoadTracksConcurrently() const;
+    void setLoadTracksConcurrently(const bool isEnabled);
+
     bool isPlayRepeatsEnabled() const;
     void setPlayRepeats(const bool isEnabled);
 
@@ -96,6 +100,17 @@ private:
         track_idx_t trackTo = mu::nidx;
     };
 
+    using TrackEventsMap = std::unordered_map<InstrumentTrackId, mpe::PlaybackEventsMap>;
+    using MeasureContext = std::vector<std::pair<mpe::dynamic_level_t, mpe::ArticulationType> >;
+
+    //! NOTE The events of a measure, rendered at one of its repeats
+    struct MeasureEventsTemplate
+    {
+        mpe::timestamp_t timestamp = 0;
+        MeasureContext context;
+        TrackEventsMap events;
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
@@ -108,10 +123,22 @@ private:
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
+    void loadEventsConcurrently(const int tickFrom, const int tickTo);
+
+    TrackEventsMap renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet,
+                                const bool renderMetronome) const;
+    void renderMeasure(const int tickPositionOffset, const Measure* measure, const int tickFrom, const int tickTo,
+                       const std::set<staff_idx_t>& staffIdxSet, const bool renderMetronome, TrackEventsMap& result) const;
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                        bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges);
+                        bool isFirstSegmentOfMeasure, TrackEventsMap& result) const;
     void processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges);
+                              const staff_idx_t staffIdx, TrackEventsMap& result) const;
+    static void appendEvents(TrackEventsMap events, const mpe::timestamp_t timestampOffset, TrackEventsMap& result);
+    void applyEvents(TrackEventsMap events, ChangedTrackIdSet* trackChanges);
+
+    bool canRenderOnce(const Measure* measure, const std::set<staff_idx_t>& staffIdxSet) const;
+    bool isMovable(const TrackEventsMap& events, const mpe::timestamp_t timestampFrom) const;
+    MeasureContext measureContext(const int tickPositionOffset, const Measure* measure, const std::set<staff_idx_t>& staffIdxSet) const;
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
@@ -135,11 +162,13 @@ private:
 
     std::vector<const EngravingItem*> filterPlaybleItems(const std::vector<const EngravingItem*>& items) const;
 
+    const PlaybackContext& playbackContext(const InstrumentTrackId& trackId) const;
     mpe::ArticulationsProfilePtr defaultActiculationProfile(const InstrumentTrackId& trackId) const;
 
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
     bool m_playChordSymbols = true;
+    bool m_loadTracksConcurrently = false;
 
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
@@ -65,9 +65,11 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const IScoreRendere
     }
 
     // Setup score draw system
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / DEVICE_DPI;
+    //! NOTE The paint state is kept by the painter, so that pages of the same score can be painted on several threads at once.
+    //! The score only keeps the printing mode for the layout and the interaction.
+    painter->setPixelRatio(mu::engraving::DPI / DEVICE_DPI);
+    painter->setIsPrinting(opt.isPrinting);
     score->setPrinting(opt.isPrinting);
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
@@ -136,8 +138,18 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const IScoreRendere
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements);
+#ifdef MUE_ENABLE_ENGRAVING_PAINT_DEBUGGER
+            //! NOTE The debug drawing goes along with the items, so the items are always painted here
+            const bool paintPageItemsByCaller = false;
+#else
+            const bool paintPageItemsByCaller = bool(opt.onPaintPageItems);
+#endif
+            if (paintPageItemsByCaller) {
+                opt.onPaintPageItems(painter, page, drawRect.translated(-pagePos));
+            } else {
+                std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
+                paintItems(*painter, elements);
+            }
 
             if (disableClipping) {
                 painter->setClipping(false);
@@ -214,7 +226,6 @@ void Paint::paintItem(mu::draw::Painter& painter, const EngravingItem* item)
     if (item->layoutData()->isSkipDraw()) {
         return;
     }
-    item->itemDiscovered = false;
     PointF itemPosition(item->pagePos());
 
     painter.translate(itemPosition);
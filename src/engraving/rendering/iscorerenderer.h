@@ -110,6 +110,8 @@ public:
         int deviceDpi = -1;
 
         std::function<void(draw::Painter* painter, const Page* page, const RectF& pageRect)> onPaintPageSheet;
+        //! NOTE If set, paints the page items instead of the renderer, drawRect is in page coordinates
+        std::function<void(draw::Painter* painter, Page* page, const RectF& drawRect)> onPaintPageItems;
         std::function<void()> onNewPage;
     };
 
@@ -435,7 +435,7 @@ void SingleDraw::draw(const Articulation* item, draw::Painter* painter)
         item->drawSymbol(item->symId(), painter, PointF(-0.5 * item->width(), 0.0));
     } else {
         mu::draw::Font scaledFont(item->font());
-        scaledFont.setPointSizeF(scaledFont.pointSizeF() * item->magS() * MScore::pixelRatio);
+        scaledFont.setPointSizeF(scaledFont.pointSizeF() * item->magS() * painter->pixelRatio());
         painter->setFont(scaledFont);
         painter->drawText(ldata->bbox(), TextDontClip | AlignLeft | AlignTop, TConv::text(item->textType()));
     }
@@ -487,7 +487,7 @@ void SingleDraw::draw(const Note* item, Painter* painter)
                 painter->fillRect(bb, config->noteBackgroundColor());
             }
 
-            if (item->fretConflict() && !item->score()->printing() && item->score()->showUnprintable()) {                //on fret conflict, draw on red background
+            if (item->fretConflict() && !painter->isPrinting() && item->score()->showUnprintable()) {                //on fret conflict, draw on red background
                 painter->save();
                 painter->setPen(config->criticalColor());
                 painter->setBrush(config->criticalColor());
@@ -496,7 +496,7 @@ void SingleDraw::draw(const Note* item, Painter* painter)
             }
         }
         mu::draw::Font f(tab->fretFont());
-        f.setPointSizeF(f.pointSizeF() * item->magS() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * item->magS() * painter->pixelRatio());
         painter->setFont(f);
         painter->setPen(c);
         double startPosX = ldata->bbox().x();
@@ -515,7 +515,7 @@ void SingleDraw::draw(const Note* item, Painter* painter)
         // warn if pitch extends usable range of instrument
         // by coloring the notehead
         if (item->chord() && item->chord()->segment() && item->staff()
-            && !item->score()->printing() && MScore::warnPitchRange && !item->staff()->isDrumStaff(item->chord()->tick())) {
+            && !painter->isPrinting() && MScore::warnPitchRange && !item->staff()->isDrumStaff(item->chord()->tick())) {
             const Instrument* in = item->part()->instrument(item->chord()->tick());
             int i = item->ppitch();
             if (i < in->minPitchP() || i > in->maxPitchP()) {
@@ -526,7 +526,7 @@ void SingleDraw::draw(const Note* item, Painter* painter)
             }
         }
         // Warn if notes are unplayable based on previous harp diagram setting
-        if (item->chord() && item->chord()->segment() && item->staff() && !item->score()->printing()
+        if (item->chord() && item->chord()->segment() && item->staff() && !painter->isPrinting()
             && !item->staff()->isDrumStaff(item->chord()->tick())) {
             HarpPedalDiagram* prevDiagram = item->part()->currentHarpDiagram(item->chord()->segment()->tick());
             if (prevDiagram && !prevDiagram->isTpcPlayable(item->tpc())) {
@@ -839,7 +839,7 @@ void SingleDraw::draw(const Bend* item, Painter* painter)
     painter->setPen(pen);
     painter->setBrush(Brush(item->curColor()));
 
-    mu::draw::Font f = item->font(_spatium * MScore::pixelRatio);
+    mu::draw::Font f = item->font(_spatium * painter->pixelRatio());
     painter->setFont(f);
 
     double x  = ldata->noteWidth + _spatium * .2;
@@ -1082,7 +1082,7 @@ void SingleDraw::draw(const FiguredBassItem* item, Painter* painter)
 
     // (use the same font selection as used in layout() above)
     double m = item->style().styleD(Sid::figuredBassFontSize) * item->spatium() / SPATIUM20;
-    f.setPointSizeF(m * MScore::pixelRatio);
+    f.setPointSizeF(m * painter->pixelRatio());
 
     painter->setFont(f);
     painter->setBrush(BrushStyle::NoBrush);
@@ -1278,7 +1278,7 @@ void SingleDraw::draw(const FretDiagram* item, Painter* painter)
         scaledFont.setPointSizeF(item->font().pointSizeF()
                                  * item->userMag()
                                  * (item->spatium() / SPATIUM20)
-                                 * MScore::pixelRatio
+                                 * painter->pixelRatio()
                                  * fretNumMag);
         painter->setFont(scaledFont);
         String text = String::number(item->fretOffset() + 1);
@@ -1370,7 +1370,7 @@ void SingleDraw::draw(const GlissandoSegment* item, Painter* painter)
             yOffset += _spatium * (glissando->glissandoType() == GlissandoType::WAVY ? 0.4 : 0.1);
 
             mu::draw::Font scaledFont(f);
-            scaledFont.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+            scaledFont.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
             painter->setFont(scaledFont);
 
             double x = (l - r.width()) * 0.5;
@@ -1479,7 +1479,7 @@ void SingleDraw::draw(const StretchedBend* item, Painter* painter)
     Pen pen(color, item->lineWidth(), PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
     painter->setPen(pen);
     painter->setBrush(Brush(color));
-    mu::draw::Font f = item->font(sp * MScore::pixelRatio);
+    mu::draw::Font f = item->font(sp * painter->pixelRatio());
     painter->setFont(f);
 
     bool isTextDrawn = false;
@@ -1786,7 +1786,7 @@ void SingleDraw::draw(const Harmony* item, Painter* painter)
     painter->setPen(color);
     for (const TextSegment* ts : item->textList()) {
         mu::draw::Font f(ts->m_font);
-        f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
 #ifndef Q_OS_MACOS
         TextBase::drawTextWorkaround(painter, f, ts->pos(), ts->text);
 #else
@@ -2258,7 +2258,7 @@ void SingleDraw::draw(const FSymbol* item, Painter* painter)
     TRACE_DRAW_ITEM;
 
     mu::draw::Font f(item->font());
-    f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+    f.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
     painter->setFont(f);
     painter->setPen(item->curColor());
     painter->drawText(PointF(0, 0), item->toString());
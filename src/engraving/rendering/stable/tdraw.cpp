@@ -150,6 +150,22 @@ using namespace mu::engraving::rtti;
 using namespace mu::engraving::rendering::stable;
 using namespace mu::draw;
 
+//! NOTE The items are painted with the printing mode of the painter
+static Color curColor(const EngravingItem* item, const Painter* painter, bool isVisible, const Color& normalColor)
+{
+    return painter->isPrinting() ? item->printingColor(normalColor) : item->curColor(isVisible, normalColor);
+}
+
+static Color curColor(const EngravingItem* item, const Painter* painter, bool isVisible)
+{
+    return curColor(item, painter, isVisible, item->color());
+}
+
+static Color curColor(const EngravingItem* item, const Painter* painter)
+{
+    return curColor(item, painter, item->visible());
+}
+
 void TDraw::drawItem(const EngravingItem* item, draw::Painter* painter)
 {
     switch (item->type()) {
@@ -368,7 +384,7 @@ void TDraw::draw(const Accidental* item, draw::Painter* painter)
         return;
     }
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     for (const Accidental::LayoutData::Sym& e : item->layoutData()->syms) {
         item->drawSymbol(e.sym, painter, PointF(e.x, e.y));
     }
@@ -393,7 +409,7 @@ void TDraw::draw(const Ambitus* item, draw::Painter* painter)
 
     double spatium = item->spatium();
     double lw = item->lineWidth().val() * spatium;
-    painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
 
     item->drawSymbol(item->noteHead(), painter, ldata->topPos);
     item->drawSymbol(item->noteHead(), painter, ldata->bottomPos);
@@ -411,7 +427,7 @@ void TDraw::draw(const Ambitus* item, draw::Painter* painter)
         double stepTolerance = step * 0.1;
         double ledgerLineLength = item->style().styleS(Sid::ledgerLineLength).val() * spatium;
         double ledgerLineWidth = item->style().styleS(Sid::ledgerLineWidth).val() * spatium;
-        painter->setPen(Pen(item->curColor(), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
 
         if (ldata->topPos.y() - stepTolerance <= -step) {
             double xMin = ldata->topPos.x() - ledgerLineLength;
@@ -444,7 +460,7 @@ void TDraw::draw(const Arpeggio* item, draw::Painter* painter)
     const double y2 = ldata->bbox().bottom();
     const double lineWidth = item->style().styleMM(Sid::ArpeggioLineWidth);
 
-    painter->setPen(Pen(item->curColor(), lineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), lineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
     painter->save();
 
     switch (item->arpeggioType()) {
@@ -498,13 +514,13 @@ void TDraw::draw(const Articulation* item, draw::Painter* painter)
 
     const Articulation::LayoutData* ldata = item->layoutData();
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
 
     if (item->textType() == ArticulationTextType::NO_TEXT) {
         item->drawSymbol(item->symId(), painter, PointF(-0.5 * item->width(), 0.0));
     } else {
         mu::draw::Font scaledFont(item->font());
-        scaledFont.setPointSizeF(scaledFont.pointSizeF() * item->magS() * MScore::pixelRatio);
+        scaledFont.setPointSizeF(scaledFont.pointSizeF() * item->magS() * painter->pixelRatio());
         painter->setFont(scaledFont);
         painter->drawText(ldata->bbox(), TextDontClip | AlignLeft | AlignTop, TConv::text(item->textType()));
     }
@@ -525,7 +541,7 @@ void TDraw::draw(const BagpipeEmbellishment* item, draw::Painter* painter)
     }
     const BagpipeEmbellishment::LayoutData::BeamData& dataBeam = data->beamData;
 
-    Pen pen(item->curColor(), data->stemLineW, PenStyle::SolidLine, PenCapStyle::FlatCap);
+    Pen pen(curColor(item, painter), data->stemLineW, PenStyle::SolidLine, PenCapStyle::FlatCap);
     painter->setPen(pen);
 
     // draw the notes including stem, (optional) flag and (optional) ledger line
@@ -553,7 +569,7 @@ void TDraw::draw(const BagpipeEmbellishment* item, draw::Painter* painter)
     }
 
     if (data->isDrawBeam) {
-        Pen beamPen(item->curColor(), dataBeam.width, PenStyle::SolidLine, PenCapStyle::FlatCap);
+        Pen beamPen(curColor(item, painter), dataBeam.width, PenStyle::SolidLine, PenCapStyle::FlatCap);
         painter->setPen(beamPen);
         // draw the beams
         auto drawBeams = [](mu::draw::Painter* painter, const double spatium,
@@ -637,33 +653,33 @@ void TDraw::draw(const BarLine* item, Painter* painter)
     switch (item->barLineType()) {
     case BarLineType::NORMAL: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(lw * .5, data->y1, lw * .5, data->y2));
     }
     break;
 
     case BarLineType::BROKEN: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::DashLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::DashLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(lw * .5, data->y1, lw * .5, data->y2));
     }
     break;
 
     case BarLineType::DOTTED: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::DotLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::DotLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(lw * .5, data->y1, lw * .5, data->y2));
     }
     break;
 
     case BarLineType::END: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         double x  = lw * .5;
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
         double lw2 = item->style().styleMM(Sid::endBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         x += ((lw * .5) + item->style().styleMM(Sid::endBarDistance) + (lw2 * .5)) * item->mag();
         painter->drawLine(LineF(x, data->y1, x, data->y2));
     }
@@ -671,7 +687,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
     case BarLineType::DOUBLE: {
         double lw = item->style().styleMM(Sid::doubleBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         double x = lw * .5;
         painter->drawLine(LineF(x, data->y1, x, data->y2));
         x += ((lw * .5) + item->style().styleMM(Sid::doubleBarDistance) + (lw * .5)) * item->mag();
@@ -681,12 +697,12 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
     case BarLineType::REVERSE_END: {
         double lw = item->style().styleMM(Sid::endBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         double x = lw * .5;
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
         double lw2 = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         x += ((lw * .5) + item->style().styleMM(Sid::endBarDistance) + (lw2 * .5)) * item->mag();
         painter->drawLine(LineF(x, data->y1, x, data->y2));
     }
@@ -694,14 +710,14 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
     case BarLineType::HEAVY: {
         double lw = item->style().styleMM(Sid::endBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(lw * .5, data->y1, lw * .5, data->y2));
     }
     break;
 
     case BarLineType::DOUBLE_HEAVY: {
         double lw2 = item->style().styleMM(Sid::endBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         double x = lw2 * .5;
         painter->drawLine(LineF(x, data->y1, x, data->y2));
         x += ((lw2 * .5) + item->style().styleMM(Sid::endBarDistance) + (lw2 * .5)) * item->mag();
@@ -711,12 +727,12 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
     case BarLineType::START_REPEAT: {
         double lw2 = item->style().styleMM(Sid::endBarWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         double x = lw2 * .5;
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         x += ((lw2 * .5) + item->style().styleMM(Sid::endBarDistance) + (lw * .5)) * item->mag();
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
@@ -731,7 +747,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
     case BarLineType::END_REPEAT: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
 
         double x = 0.0;
         drawDots(item, painter, x);
@@ -742,7 +758,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
         double lw2 = item->style().styleMM(Sid::endBarWidth) * item->mag();
         x += ((lw * .5) + item->style().styleMM(Sid::endBarDistance) + (lw2 * .5)) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
         if (item->style().styleB(Sid::repeatBarTips)) {
@@ -752,7 +768,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
     break;
     case BarLineType::END_START_REPEAT: {
         double lw = item->style().styleMM(Sid::barWidth) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
 
         double x = 0.0;
         drawDots(item, painter, x);
@@ -763,14 +779,14 @@ void TDraw::draw(const BarLine* item, Painter* painter)
 
         double lw2 = item->style().styleMM(Sid::endBarWidth) * item->mag();
         x += ((lw * .5) + item->style().styleMM(Sid::endBarDistance) + (lw2 * .5)) * item->mag();
-        painter->setPen(Pen(item->curColor(), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw2, PenStyle::SolidLine, PenCapStyle::FlatCap));
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
         if (item->style().styleB(Sid::repeatBarTips)) {
             drawTips(item, data, painter, true, x + lw2 * .5);
         }
 
-        painter->setPen(Pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
         x  += ((lw2 * .5) + item->style().styleMM(Sid::endBarDistance) + (lw * .5)) * item->mag();
         painter->drawLine(LineF(x, data->y1, x, data->y2));
 
@@ -784,7 +800,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
     break;
     }
     Segment* s = item->segment();
-    if (s && s->isEndBarLineType() && !item->score()->printing() && item->score()->showUnprintable()) {
+    if (s && s->isEndBarLineType() && !painter->isPrinting() && item->score()->showUnprintable()) {
         Measure* m = s->measure();
         if (m->isIrregular() && item->score()->markIrregularMeasures() && !m->isMMRest()) {
             painter->setPen(EngravingItem::engravingConfiguration()->formattingMarksColor());
@@ -795,7 +811,7 @@ void TDraw::draw(const BarLine* item, Painter* painter)
             RectF r = FontMetrics(f).boundingRect(ch);
 
             mu::draw::Font scaledFont(f);
-            scaledFont.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+            scaledFont.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
             painter->setFont(scaledFont);
 
             painter->drawText(-r.width(), 0.0, ch);
@@ -809,7 +825,7 @@ void TDraw::draw(const Beam* item, Painter* painter)
     if (item->beamSegments().empty()) {
         return;
     }
-    painter->setBrush(mu::draw::Brush(item->curColor()));
+    painter->setBrush(mu::draw::Brush(curColor(item, painter)));
     painter->setNoPen();
 
     // make beam thickness independent of slant
@@ -846,11 +862,11 @@ void TDraw::draw(const Bend* item, Painter* painter)
     double spatium = item->spatium();
     double lw = item->lineWidth();
 
-    Pen pen(item->curColor(), lw, PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
+    Pen pen(curColor(item, painter), lw, PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
     painter->setPen(pen);
-    painter->setBrush(Brush(item->curColor()));
+    painter->setBrush(Brush(curColor(item, painter)));
 
-    mu::draw::Font f = item->font(spatium * MScore::pixelRatio);
+    mu::draw::Font f = item->font(spatium * painter->pixelRatio());
     painter->setFont(f);
 
     double x  = data->noteWidth + spatium * .2;
@@ -871,7 +887,7 @@ void TDraw::draw(const Bend* item, Painter* painter)
             x2 = x;
             painter->drawLine(LineF(x, y, x2, y2));
 
-            painter->setBrush(item->curColor());
+            painter->setBrush(curColor(item, painter));
             painter->drawPolygon(arrowUp.translated(x2, y2));
 
             int idx = (pitch + 12) / 25;
@@ -902,7 +918,7 @@ void TDraw::draw(const Bend* item, Painter* painter)
             painter->setBrush(BrushStyle::NoBrush);
             painter->drawPath(path);
 
-            painter->setBrush(item->curColor());
+            painter->setBrush(curColor(item, painter));
             painter->drawPolygon(arrowUp.translated(x2, y2));
 
             int idx = (item->points()[pt + 1].pitch + 12) / 25;
@@ -924,7 +940,7 @@ void TDraw::draw(const Bend* item, Painter* painter)
             painter->setBrush(BrushStyle::NoBrush);
             painter->drawPath(path);
 
-            painter->setBrush(item->curColor());
+            painter->setBrush(curColor(item, painter));
             painter->drawPolygon(arrowDown.translated(x2, y2));
         }
         x = x2;
@@ -935,7 +951,7 @@ void TDraw::draw(const Bend* item, Painter* painter)
 void TDraw::draw(const Box* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    if (item->score() && item->score()->printing()) {
+    if (painter->isPrinting()) {
         return;
     }
 
@@ -998,12 +1014,12 @@ void TDraw::draw(const Bracket* item, Painter* painter)
     case BracketType::BRACE: {
         if (data->braceSymbol == SymId::noSym) {
             painter->setNoPen();
-            painter->setBrush(Brush(item->curColor()));
+            painter->setBrush(Brush(curColor(item, painter)));
             painter->drawPath(data->path);
         } else {
             double h = 2 * item->h2();
             double mag = h / (100 * item->magS());
-            painter->setPen(item->curColor());
+            painter->setPen(curColor(item, painter));
             painter->save();
             painter->scale(item->magx(), mag);
             item->drawSymbol(data->braceSymbol, painter, PointF(0, 100 * item->magS()));
@@ -1016,7 +1032,7 @@ void TDraw::draw(const Bracket* item, Painter* painter)
         double spatium = item->spatium();
         double w = item->style().styleMM(Sid::bracketWidth);
         double bd = (item->style().styleSt(Sid::MusicalSymbolFont) == "Leland") ? spatium * .5 : spatium * .25;
-        Pen pen(item->curColor(), w, PenStyle::SolidLine, PenCapStyle::FlatCap);
+        Pen pen(curColor(item, painter), w, PenStyle::SolidLine, PenCapStyle::FlatCap);
         painter->setPen(pen);
         painter->drawLine(LineF(0.0, -bd - w * .5, 0.0, h + bd + w * .5));
         double x = -w * .5;
@@ -1030,7 +1046,7 @@ void TDraw::draw(const Bracket* item, Painter* painter)
         double h = 2 * item->h2();
         double lineW = item->style().styleMM(Sid::staffLineWidth);
         double bracketWidth = item->width() - lineW / 2;
-        Pen pen(item->curColor(), lineW, PenStyle::SolidLine, PenCapStyle::FlatCap);
+        Pen pen(curColor(item, painter), lineW, PenStyle::SolidLine, PenCapStyle::FlatCap);
         painter->setPen(pen);
         painter->drawLine(LineF(0.0, 0.0, 0.0, h));
         painter->drawLine(LineF(-lineW / 2, 0.0, lineW / 2 + bracketWidth, 0.0));
@@ -1040,7 +1056,7 @@ void TDraw::draw(const Bracket* item, Painter* painter)
     case BracketType::LINE: {
         double h = 2 * item->h2();
         double w = 0.67 * item->style().styleMM(Sid::bracketWidth);
-        Pen pen(item->curColor(), w, PenStyle::SolidLine, PenCapStyle::FlatCap);
+        Pen pen(curColor(item, painter), w, PenStyle::SolidLine, PenCapStyle::FlatCap);
         painter->setPen(pen);
         double bd = item->style().styleMM(Sid::staffLineWidth) * 0.5;
         painter->drawLine(LineF(0.0, -bd, 0.0, h + bd));
@@ -1054,7 +1070,7 @@ void TDraw::draw(const Bracket* item, Painter* painter)
 void TDraw::draw(const Breath* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(item->symId(), painter);
 }
 
@@ -1067,7 +1083,7 @@ void TDraw::draw(const ChordLine* item, Painter* painter)
     }
 
     if (!item->isWavy()) {
-        painter->setPen(Pen(item->curColor(), item->style().styleMM(Sid::chordlineThickness) * item->mag(), PenStyle::SolidLine));
+        painter->setPen(Pen(curColor(item, painter), item->style().styleMM(Sid::chordlineThickness) * item->mag(), PenStyle::SolidLine));
         painter->setBrush(BrushStyle::NoBrush);
         painter->drawPath(ldata->path);
     } else {
@@ -1090,7 +1106,7 @@ void TDraw::draw(const Clef* item, Painter* painter)
         return;
     }
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(ldata->symId, painter);
 }
 
@@ -1108,7 +1124,7 @@ void TDraw::draw(const DeadSlapped* item, Painter* painter)
     }
 
     painter->setPen(draw::PenStyle::NoPen);
-    painter->setBrush(item->curColor());
+    painter->setBrush(curColor(item, painter));
     painter->drawPath(ldata->path1);
     painter->drawPath(ldata->path2);
 }
@@ -1126,7 +1142,7 @@ void TDraw::draw(const Expression* item, Painter* painter)
 void TDraw::draw(const Fermata* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(item->symId(), painter, PointF(-0.5 * item->width(), 0.0));
 }
 
@@ -1135,7 +1151,7 @@ void TDraw::draw(const FiguredBass* item, Painter* painter)
     TRACE_DRAW_ITEM;
     const FiguredBass::LayoutData* ldata = item->layoutData();
     // if not printing, draw duration line(s)
-    if (!item->score()->printing() && item->score()->showUnprintable()) {
+    if (!painter->isPrinting() && item->score()->showUnprintable()) {
         for (double len : ldata->lineLengths) {
             if (len > 0) {
                 painter->setPen(Pen(FiguredBass::engravingConfiguration()->formattingMarksColor(), 3));
@@ -1167,11 +1183,11 @@ void TDraw::draw(const FiguredBassItem* item, Painter* painter)
 
     // (use the same font selection as used in layout() above)
     double m = item->style().styleD(Sid::figuredBassFontSize) * item->spatium() / SPATIUM20;
-    f.setPointSizeF(m * MScore::pixelRatio);
+    f.setPointSizeF(m * painter->pixelRatio());
 
     painter->setFont(f);
     painter->setBrush(BrushStyle::NoBrush);
-    Pen pen(item->figuredBass()->curColor(), FiguredBass::FB_CONTLINE_THICKNESS * _spatium, PenStyle::SolidLine, PenCapStyle::RoundCap);
+    Pen pen(curColor(item->figuredBass(), painter), FiguredBass::FB_CONTLINE_THICKNESS * _spatium, PenStyle::SolidLine, PenCapStyle::RoundCap);
     painter->setPen(pen);
     painter->drawText(ldata->bbox(), draw::TextDontClip | draw::AlignLeft | draw::AlignTop, ldata->displayText);
 
@@ -1240,7 +1256,7 @@ void TDraw::draw(const FretDiagram* item, Painter* painter)
 
     // Init pen and other values
     double _spatium = item->spatium() * item->userMag();
-    Pen pen(item->curColor());
+    Pen pen(curColor(item, painter));
     pen.setCapStyle(PenCapStyle::FlatCap);
     painter->setBrush(Brush(Color(painter->pen().color())));
 
@@ -1362,7 +1378,7 @@ void TDraw::draw(const FretDiagram* item, Painter* painter)
         scaledFont.setPointSizeF(item->font().pointSizeF()
                                  * item->userMag()
                                  * (item->spatium() / SPATIUM20)
-                                 * MScore::pixelRatio
+                                 * painter->pixelRatio()
                                  * fretNumMag);
         painter->setFont(scaledFont);
         String text = String::number(item->fretOffset() + 1);
@@ -1403,7 +1419,7 @@ void TDraw::draw(const FretCircle* item, Painter* painter)
     TRACE_DRAW_ITEM;
     const FretCircle::LayoutData* ldata = item->layoutData();
     painter->save();
-    painter->setPen(mu::draw::Pen(item->curColor(), item->spatium() * FretCircle::CIRCLE_WIDTH));
+    painter->setPen(mu::draw::Pen(curColor(item, painter), item->spatium() * FretCircle::CIRCLE_WIDTH));
     painter->setBrush(mu::draw::BrushStyle::NoBrush);
     painter->drawEllipse(ldata->rect);
     painter->restore();
@@ -1421,7 +1437,7 @@ void TDraw::draw(const GlissandoSegment* item, Painter* painter)
     double _spatium = item->spatium();
     const Glissando* glissando = item->glissando();
 
-    Pen pen(item->curColor(item->visible(), glissando->lineColor()));
+    Pen pen(curColor(item, painter, item->visible(), glissando->lineColor()));
     pen.setWidthF(glissando->lineWidth());
     pen.setCapStyle(PenCapStyle::RoundCap);
     painter->setPen(pen);
@@ -1465,7 +1481,7 @@ void TDraw::draw(const GlissandoSegment* item, Painter* painter)
             yOffset += _spatium * (glissando->glissandoType() == GlissandoType::WAVY ? 0.4 : 0.1);
 
             mu::draw::Font scaledFont(f);
-            scaledFont.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+            scaledFont.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
             painter->setFont(scaledFont);
 
             double x = (l - r.width()) * 0.5;
@@ -1480,13 +1496,13 @@ void TDraw::draw(const StretchedBend* item, Painter* painter)
     TRACE_DRAW_ITEM;
 
     double sp = item->spatium();
-    const mu::draw::Color& color = item->curColor();
+    const mu::draw::Color& color = curColor(item, painter);
     const int textFlags = item->textFlags();
 
     Pen pen(color, item->lineWidth(), PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
     painter->setPen(pen);
     painter->setBrush(Brush(color));
-    mu::draw::Font f = item->font(sp * MScore::pixelRatio);
+    mu::draw::Font f = item->font(sp * painter->pixelRatio());
     painter->setFont(f);
 
     bool isTextDrawn = false;
@@ -1560,7 +1576,7 @@ void TDraw::drawTextBase(const TextBase* item, Painter* painter)
     if (item->hasFrame()) {
         double baseSpatium = DefaultStyle::baseStyle().value(Sid::spatium).toReal();
         if (item->frameWidth().val() != 0.0) {
-            Color fColor = item->curColor(item->visible(), item->frameColor());
+            Color fColor = curColor(item, painter, item->visible(), item->frameColor());
             double frameWidthVal = item->frameWidth().val() * (item->sizeIsSpatiumDependent() ? item->spatium() : baseSpatium);
 
             Pen pen(fColor, frameWidthVal, PenStyle::SolidLine, PenCapStyle::SquareCap, PenJoinStyle::MiterJoin);
@@ -1583,7 +1599,7 @@ void TDraw::drawTextBase(const TextBase* item, Painter* painter)
         }
     }
     painter->setBrush(BrushStyle::NoBrush);
-    painter->setPen(item->textColor());
+    painter->setPen(curColor(item, painter));
     for (const TextBlock& t : ldata->blocks) {
         t.draw(painter, item);
     }
@@ -1608,12 +1624,12 @@ void TDraw::drawTextLineBaseSegment(const TextLineBaseSegment* item, Painter* pa
     }
 
     if ((item->npoints() == 0)
-        || (item->score() && (item->score()->printing() || !item->score()->isShowInvisible()) && !tl->lineVisible())) {
+        || (item->score() && (painter->isPrinting() || !item->score()->isShowInvisible()) && !tl->lineVisible())) {
         return;
     }
 
     // color for line (text color comes from the text properties)
-    Color color = item->curColor(tl->visible() && tl->lineVisible(), tl->lineColor());
+    Color color = curColor(item, painter, tl->visible() && tl->lineVisible(), tl->lineColor());
 
     double lineWidth = tl->lineWidth() * item->mag();
 
@@ -1725,7 +1741,7 @@ void TDraw::draw(const HairpinSegment* item, Painter* painter)
     drawTextLineBaseSegment(item, painter);
 
     if (item->drawCircledTip()) {
-        Color color = item->curColor(item->hairpin()->visible(), item->hairpin()->lineColor());
+        Color color = curColor(item, painter, item->hairpin()->visible(), item->hairpin()->lineColor());
         double w = item->hairpin()->lineWidth();
         if (item->staff()) {
             w *= item->staff()->staffMag(item->hairpin()->tick());
@@ -1788,11 +1804,11 @@ void TDraw::draw(const Harmony* item, Painter* painter)
         }
     }
     painter->setBrush(BrushStyle::NoBrush);
-    Color color = item->textColor();
+    Color color = curColor(item, painter);
     painter->setPen(color);
     for (const TextSegment* ts : item->textList()) {
         mu::draw::Font f(ts->m_font);
-        f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
 #ifndef Q_OS_MACOS
         TextBase::drawTextWorkaround(painter, f, ts->pos(), ts->text);
 #else
@@ -1810,7 +1826,7 @@ void TDraw::draw(const Hook* item, Painter* painter)
         return;
     }
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(item->sym(), painter);
 }
 
@@ -1836,7 +1852,7 @@ void TDraw::draw(const Image* item, Painter* painter)
             } else {
                 s = item->size() * DPMM;
             }
-            if (item->score() && item->score()->printing() && !MScore::svgPrinting) {
+            if (painter->isPrinting() && !painter->isSvgPrinting()) {
                 // use original image size for printing, but not for svg for reasonable file size.
                 painter->scale(s.width() / item->rasterImage()->width(), s.height() / item->rasterImage()->height());
                 painter->drawPixmap(PointF(0, 0), *item->rasterImage());
@@ -1866,7 +1882,7 @@ void TDraw::draw(const Image* item, Painter* painter)
         painter->drawLine(0.0, 0.0, ldata->bbox().width(), ldata->bbox().height());
         painter->drawLine(ldata->bbox().width(), 0.0, 0.0, ldata->bbox().height());
     }
-    if (item->selected() && !(item->score() && item->score()->printing())) {
+    if (item->selected() && !(painter->isPrinting())) {
         painter->setBrush(mu::draw::BrushStyle::NoBrush);
         painter->setPen(item->engravingConfiguration()->selectionColor());
         painter->drawRect(ldata->bbox());
@@ -1896,7 +1912,7 @@ void TDraw::draw(const KeySig* item, Painter* painter)
     TRACE_DRAW_ITEM;
     const KeySig::LayoutData* ldata = item->layoutData();
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     double _spatium = item->spatium();
     double step = _spatium * (item->staff() ? item->staff()->staffTypeForElement(item)->lineDistance().val() * 0.5 : 0.5);
     int lines = item->staff() ? item->staff()->staffTypeForElement(item)->lines() : 5;
@@ -1910,7 +1926,7 @@ void TDraw::draw(const KeySig* item, Painter* painter)
         double _symWidth = item->symWidth(ks.sym);
         double x1 = x - ledgerExtraLen;
         double x2 = x + _symWidth + ledgerExtraLen;
-        painter->setPen(Pen(item->curColor(), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
+        painter->setPen(Pen(curColor(item, painter), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
         for (int i = -2; i >= ks.line; i -= 2) { // above
             y = i * step;
             painter->drawLine(LineF(x1, y, x2, y));
@@ -1937,7 +1953,7 @@ void TDraw::draw(const LayoutBreak* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
 
-    if (item->score()->printing() || !item->score()->showUnprintable()) {
+    if (painter->isPrinting() || !item->score()->showUnprintable()) {
         return;
     }
 
@@ -1971,7 +1987,7 @@ void TDraw::draw(const LedgerLine* item, Painter* painter)
 
     const LedgerLine::LayoutData* ldata = item->layoutData();
 
-    painter->setPen(Pen(item->curColor(), ldata->lineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), ldata->lineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
     if (item->vertical()) {
         painter->drawLine(LineF(0.0, 0.0, 0.0, item->len()));
     } else {
@@ -1999,7 +2015,7 @@ void TDraw::draw(const LyricsLineSegment* item, Painter* painter)
         return;
     }
 
-    Pen pen(item->lyricsLine()->lyrics()->curColor());
+    Pen pen(curColor(item->lyricsLine()->lyrics(), painter));
     pen.setWidthF(item->lyricsLine()->lineWidth());
     pen.setCapStyle(PenCapStyle::FlatCap);
     painter->setPen(pen);
@@ -2032,7 +2048,7 @@ void TDraw::draw(const MeasureRepeat* item, Painter* painter)
 
     const MeasureRepeat::LayoutData* ldata = item->layoutData();
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(ldata->symId, painter);
 
     if (!ldata->numberSym.empty()) {
@@ -2072,7 +2088,7 @@ void TDraw::draw(const MMRest* item, Painter* painter)
     double _spatium = item->spatium();
 
     // draw number
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     RectF numberBox = item->symBbox(ldata->numberSym);
     PointF numberPos = item->numberPosition(numberBox);
     if (item->numberVisible()) {
@@ -2146,7 +2162,7 @@ void TDraw::draw(const Note* item, Painter* painter)
 
     bool negativeFret = item->negativeFretUsed() && item->staff()->isTabStaff(item->tick());
 
-    Color c(negativeFret ? config->criticalColor() : item->curColor());
+    Color c(negativeFret ? config->criticalColor() : curColor(item, painter));
     painter->setPen(c);
     bool tablature = item->staff() && item->staff()->isTabStaff(item->chord()->tick());
 
@@ -2182,7 +2198,7 @@ void TDraw::draw(const Note* item, Painter* painter)
                 painter->fillRect(bb, config->noteBackgroundColor());
             }
 
-            if (item->fretConflict() && !item->score()->printing() && item->score()->showUnprintable()) {                //on fret conflict, draw on red background
+            if (item->fretConflict() && !painter->isPrinting() && item->score()->showUnprintable()) {                //on fret conflict, draw on red background
                 painter->save();
                 painter->setPen(config->criticalColor());
                 painter->setBrush(config->criticalColor());
@@ -2191,7 +2207,7 @@ void TDraw::draw(const Note* item, Painter* painter)
             }
         }
         mu::draw::Font f(tab->fretFont());
-        f.setPointSizeF(f.pointSizeF() * item->magS() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * item->magS() * painter->pixelRatio());
         painter->setFont(f);
         painter->setPen(c);
         double startPosX = ldata->bbox().x();
@@ -2210,7 +2226,7 @@ void TDraw::draw(const Note* item, Painter* painter)
         // warn if pitch extends usable range of instrument
         // by coloring the notehead
         if (item->chord() && item->chord()->segment() && item->staff()
-            && !item->score()->printing() && MScore::warnPitchRange && !item->staff()->isDrumStaff(item->chord()->tick())) {
+            && !painter->isPrinting() && MScore::warnPitchRange && !item->staff()->isDrumStaff(item->chord()->tick())) {
             const Instrument* in = item->part()->instrument(item->chord()->tick());
             int i = item->ppitch();
             if (i < in->minPitchP() || i > in->maxPitchP()) {
@@ -2221,7 +2237,7 @@ void TDraw::draw(const Note* item, Painter* painter)
             }
         }
         // Warn if notes are unplayable based on previous harp diagram setting
-        if (item->chord() && item->chord()->segment() && item->staff() && !item->score()->printing()
+        if (item->chord() && item->chord()->segment() && item->staff() && !painter->isPrinting()
             && !item->staff()->isDrumStaff(item->chord()->tick())) {
             HarpPedalDiagram* prevDiagram = item->part()->currentHarpDiagram(item->chord()->segment()->tick());
             if (prevDiagram && !prevDiagram->isTpcPlayable(item->tpc())) {
@@ -2254,7 +2270,7 @@ void TDraw::draw(const NoteDot* item, Painter* painter)
     if (!item->staff()->isTabStaff(tick)
         || (n && item->staff()->staffType(tick)->stemThrough())
         || (!n && item->staff()->staffType(tick)->showRests())) {
-        painter->setPen(item->curColor());
+        painter->setPen(curColor(item, painter));
         item->drawSymbol(SymId::augmentationDot, painter);
     }
 }
@@ -2281,7 +2297,7 @@ void TDraw::draw(const Page* item, Painter* painter)
     //
 
     page_idx_t n = item->no() + 1 + item->score()->pageNumberOffset();
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
 
     auto drawHeaderFooter = [item](mu::draw::Painter* p, int area, const String& ss)
     {
@@ -2377,7 +2393,7 @@ void TDraw::draw(const Rest* item, Painter* painter)
 
     const Rest::LayoutData* ldata = item->layoutData();
 
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     item->drawSymbol(ldata->sym(), painter);
 }
 
@@ -2482,7 +2498,7 @@ void TDraw::draw(const SlurSegment* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
 
-    Pen pen(item->curColor());
+    Pen pen(curColor(item, painter));
     double mag = item->staff() ? item->staff()->staffMag(item->slur()->tick()) : 1.0;
 
     //Replace generic Qt dash patterns with improved equivalents to show true dots (keep in sync with tie.cpp)
@@ -2523,7 +2539,7 @@ void TDraw::draw(const SlurSegment* item, Painter* painter)
 void TDraw::draw(const Spacer* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    if (item->score()->printing() || !item->score()->showUnprintable()) {
+    if (painter->isPrinting() || !item->score()->showUnprintable()) {
         return;
     }
 
@@ -2539,14 +2555,14 @@ void TDraw::draw(const Spacer* item, Painter* painter)
 void TDraw::draw(const StaffLines* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    painter->setPen(Pen(item->curColor(), item->lw(), PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), item->lw(), PenStyle::SolidLine, PenCapStyle::FlatCap));
     painter->drawLines(item->lines());
 }
 
 void TDraw::draw(const StaffState* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    if (item->score()->printing() || !item->score()->showUnprintable()) {
+    if (painter->isPrinting() || !item->score()->showUnprintable()) {
         return;
     }
 
@@ -2570,7 +2586,7 @@ void TDraw::draw(const StaffTypeChange* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
 
-    if (item->score()->printing() || !item->score()->showUnprintable()) {
+    if (painter->isPrinting() || !item->score()->showUnprintable()) {
         return;
     }
 
@@ -2626,7 +2642,7 @@ void TDraw::draw(const Stem* item, Painter* painter)
     const StaffType* staffType = staff ? staff->staffTypeForElement(item->chord()) : nullptr;
     const bool isTablature = staffType && staffType->isTabStaff();
 
-    painter->setPen(Pen(item->curColor(), item->lineWidthMag(), PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), item->lineWidthMag(), PenStyle::SolidLine, PenCapStyle::FlatCap));
     painter->drawLine(ldata->line);
 
     if (!isTablature) {
@@ -2663,7 +2679,7 @@ void TDraw::draw(const Stem* item, Painter* painter)
             path.closeSubpath();
             y += displ;
         }
-        painter->setBrush(Brush(item->curColor()));
+        painter->setBrush(Brush(curColor(item, painter)));
         painter->setNoPen();
         painter->drawPath(path);
     }
@@ -2686,7 +2702,7 @@ void TDraw::draw(const StemSlash* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
     const StemSlash::LayoutData* ldata = item->layoutData();
-    painter->setPen(Pen(item->curColor(), ldata->stemWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->setPen(Pen(curColor(item, painter), ldata->stemWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
     painter->drawLine(ldata->line);
 }
 
@@ -2700,7 +2716,7 @@ void TDraw::draw(const Symbol* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
     if (!item->isNoteDot() || !item->staff()->isTabStaff(item->tick())) {
-        painter->setPen(item->curColor());
+        painter->setPen(curColor(item, painter));
         if (item->scoreFont()) {
             item->scoreFont()->draw(item->sym(), painter, item->magS(), PointF());
         } else {
@@ -2714,9 +2730,9 @@ void TDraw::draw(const FSymbol* item, Painter* painter)
     TRACE_DRAW_ITEM;
 
     mu::draw::Font f(item->font());
-    f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+    f.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
     painter->setFont(f);
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
     painter->drawText(PointF(0, 0), item->toString());
 }
 
@@ -2752,13 +2768,13 @@ void TDraw::draw(const TabDurationSymbol* item, Painter* painter)
     double mag = item->magS();
     double imag = 1.0 / mag;
 
-    Pen pen(item->curColor());
+    Pen pen(curColor(item, painter));
     painter->setPen(pen);
     painter->scale(mag, mag);
     if (ldata->beamGrid == TabBeamGrid::NONE) {
         // if no beam grid, draw symbol
         mu::draw::Font f(item->tab()->durationFont());
-        f.setPointSizeF(f.pointSizeF() * MScore::pixelRatio);
+        f.setPointSizeF(f.pointSizeF() * painter->pixelRatio());
         painter->setFont(f);
         painter->drawText(PointF(0.0, 0.0), item->text());
     } else {
@@ -2818,7 +2834,7 @@ void TDraw::draw(const TieSegment* item, Painter* painter)
         return;
     }
 
-    Pen pen(item->curColor());
+    Pen pen(curColor(item, painter));
     double mag = item->staff() ? item->staff()->staffMag(item->tie()->tick()) : 1.0;
 
     //Replace generic Qt dash patterns with improved equivalents to show true dots (keep in sync with slur.cpp)
@@ -2863,7 +2879,7 @@ void TDraw::draw(const TimeSig* item, Painter* painter)
     if (item->staff() && !const_cast<const Staff*>(item->staff())->staffType(item->tick())->genTimesig()) {
         return;
     }
-    painter->setPen(item->curColor());
+    painter->setPen(curColor(item, painter));
 
     const TimeSig::LayoutData* ldata = item->layoutData();
 
@@ -2881,10 +2897,10 @@ void TDraw::draw(const Tremolo* item, Painter* painter)
     TRACE_DRAW_ITEM;
 
     if (item->isBuzzRoll()) {
-        painter->setPen(item->curColor());
+        painter->setPen(curColor(item, painter));
         item->drawSymbol(SymId::buzzRoll, painter);
     } else if (!item->twoNotes() || !item->explicitParent()) {
-        painter->setBrush(Brush(item->curColor()));
+        painter->setBrush(Brush(curColor(item, painter)));
         painter->setNoPen();
         painter->drawPath(item->path());
     } else if (item->twoNotes() && !item->beamSegments().empty()) {
@@ -2898,7 +2914,7 @@ void TDraw::draw(const Tremolo* item, Painter* painter)
             d = M_PI / 6.0;
         }
         double ww = (item->beamWidth() / 2.0) / sin(M_PI_2 - atan(d));
-        painter->setBrush(Brush(item->curColor()));
+        painter->setBrush(Brush(curColor(item, painter)));
         painter->setNoPen();
         for (const BeamSegment* bs1 : item->beamSegments()) {
             painter->drawPolygon(
@@ -2917,7 +2933,7 @@ void TDraw::draw(const TremoloBar* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
     const TremoloBar::LayoutData* ldata = item->layoutData();
-    Pen pen(item->curColor(), item->lineWidth().val(), PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
+    Pen pen(curColor(item, painter), item->lineWidth().val(), PenStyle::SolidLine, PenCapStyle::RoundCap, PenJoinStyle::RoundJoin);
     painter->setPen(pen);
     painter->drawPolyline(ldata->polygon);
 }
@@ -2925,7 +2941,7 @@ void TDraw::draw(const TremoloBar* item, Painter* painter)
 void TDraw::draw(const TrillSegment* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    painter->setPen(item->spanner()->curColor());
+    painter->setPen(curColor(item->spanner(), painter));
     item->drawSymbols(item->symbols(), painter);
 }
 
@@ -2945,7 +2961,7 @@ void TDraw::draw(const Tuplet* item, Painter* painter)
         return;
     }
 
-    Color color(item->curColor());
+    Color color(curColor(item, painter));
     if (item->number()) {
         painter->setPen(color);
         PointF pos(item->number()->pos());
@@ -2967,7 +2983,7 @@ void TDraw::draw(const Tuplet* item, Painter* painter)
 void TDraw::draw(const VibratoSegment* item, Painter* painter)
 {
     TRACE_DRAW_ITEM;
-    painter->setPen(item->spanner()->curColor());
+    painter->setPen(curColor(item->spanner(), painter));
     item->drawSymbols(item->symbols(), painter);
 }
 
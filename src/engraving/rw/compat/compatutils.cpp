@@ -100,6 +100,22 @@ void CompatUtils::doCompatibilityConversions(MasterScore* masterScore)
     }
 }
 
+bool CompatUtils::needsCompatibilityConversions(const MasterScore* masterScore)
+{
+    if (!masterScore) {
+        return false;
+    }
+
+    if (masterScore->mscVersion() < 410) {
+        return true;
+    }
+    if (masterScore->mscVersion() < 420) {
+        return hasMissingInitKeyForTransposingInstrument(masterScore);
+    }
+
+    return false;
+}
+
 void CompatUtils::replaceStaffTextWithPlayTechniqueAnnotation(MasterScore* score)
 {
     TRACEFUNC;
@@ -687,3 +703,22 @@ void CompatUtils::addMissingInitKeyForTransposingInstrument(MasterScore* score)
         }
     }
 }
+
+bool CompatUtils::hasMissingInitKeyForTransposingInstrument(const MasterScore* score)
+{
+    for (Part* part : score->parts()) {
+        Interval v = part->instrument()->transpose();
+        if (!(v.chromatic % 12)) {
+            continue;
+        }
+
+        for (Staff* staff : part->staves()) {
+            KeyList* keys = staff->keyList();
+            if (keys->find(0) == keys->end()) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
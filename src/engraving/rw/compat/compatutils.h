@@ -42,6 +42,7 @@ class CompatUtils
 public:
     static void assignInitialPartToExcerpts(const std::vector<Excerpt*>& excerpts);
     static void doCompatibilityConversions(MasterScore* masterScore);
+    static bool needsCompatibilityConversions(const MasterScore* masterScore);
     static ArticulationAnchor translateToNewArticulationAnchor(int anchor);
     static const std::set<SymId> ORNAMENT_IDS;
 
@@ -57,6 +58,7 @@ private:
     static void resetStemLengthsForTwoNoteTrems(MasterScore* masterScore);
     static void replaceStaffTextWithCapo(MasterScore* masterScore);
     static void addMissingInitKeyForTransposingInstrument(MasterScore* score);
+    static bool hasMissingInitKeyForTransposingInstrument(const MasterScore* score);
 };
 }
 #endif // MU_ENGRAVING_COMPATUTILS_H
@@ -48,6 +48,9 @@ using namespace mu::io;
 using namespace mu::engraving;
 using namespace mu::engraving::rw;
 
+//! NOTE The header of an excerpt fits in this size, unless the excerpt has a lot of meta tags
+static constexpr size_t EXCERPT_HEADER_MAX_SIZE = 16 * 1024;
+
 static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
 {
     if (!ignoreVersionError) {
@@ -71,6 +74,52 @@ static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
     return RetVal<IReaderPtr>::make_ok(RWRegister::reader(version));
 }
 
+static Ret readExcerptScore(Score* partScore, const ByteArray& excerptData, const String& excerptName,
+                            const ReadLinks& masterLinks, int mscVersion, bool ignoreVersionError)
+{
+    XmlReader xml(excerptData);
+    xml.setDocName(excerptName);
+
+    ReadInOutData partReadInData;
+    partReadInData.links = masterLinks;
+
+    RetVal<IReaderPtr> reader = makeReader(mscVersion, ignoreVersionError);
+    if (!reader.ret) {
+        return reader.ret;
+    }
+
+    Err err = reader.val->readScore(partScore, xml, &partReadInData);
+    return make_ret(err);
+}
+
+//! NOTE Reads only the tags preceding the score content, which are needed before the excerpt is read.
+//! Returns false if the data ends before the score content
+static bool readExcerptHeader(Score* partScore, const ByteArray& excerptData, const String& excerptName)
+{
+    XmlReader xml(excerptData);
+    xml.setDocName(excerptName);
+
+    while (xml.readNextStartElement()) {
+        const AsciiStringView tag(xml.name());
+        if (tag == "museScore" || tag == "Score") {
+            // pass
+        } else if (tag == "open") {
+            partScore->setIsOpen(xml.readBool());
+        } else if (tag == "initialPartId") {
+            partScore->excerpt()->setInitialPartId(ID(xml.readInt()));
+        } else if (tag == "metaTag") {
+            String name = xml.attribute("name");
+            partScore->setMetaTag(name, xml.readText());
+        } else if (tag == "Part" || tag == "Staff") {
+            return true;
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    return false;
+}
+
 mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, SettingsCompat& settingsCompat,
                             bool ignoreVersionError)
 {
@@ -133,6 +182,17 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
 
     // Read excerpts
     if (ret && masterScore->mscVersion() >= 400) {
+        //! NOTE Reading and laying out the excerpts takes a significant part of the loading time,
+        //! so the excerpts that are not open are read on the first demand (see MasterScore::loadDeferredExcerpt).
+        //! The compatibility conversions need all the excerpts, so they are read now in this case
+        const bool canDeferExcerpts = mscReader.params().mode == MscIoMode::Zip
+                                      && !compat::CompatUtils::needsCompatibilityConversions(masterScore);
+
+        //! NOTE The links refer to the elements of the master score, they remain valid until it is edited,
+        //! and any edit reads the deferred excerpts first (see Score::startCmd)
+        std::shared_ptr<ReadLinks> masterLinks = std::make_shared<ReadLinks>(masterReadOutData.links);
+        const int mscVersion = masterScore->mscVersion();
+
         std::vector<String> excerptNames = mscReader.excerptNames();
         for (const String& excerptName : excerptNames) {
             Score* partScore = masterScore->createScore();
@@ -147,22 +207,44 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
-
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptName);
-
-            ReadInOutData partReadInData;
-            partReadInData.links = masterReadOutData.links;
+            ByteArray excerptData;
+
+            if (canDeferExcerpts) {
+                ZipReader::RawFileData rawExcerptData = mscReader.readRawExcerptFile(excerptName);
+                if (rawExcerptData.isValid) {
+                    //! NOTE Only the beginning of the excerpt is uncompressed for the header,
+                    //! the whole excerpt is uncompressed once, when it's read
+                    if (!readExcerptHeader(partScore, rawExcerptData.uncompressedData(EXCERPT_HEADER_MAX_SIZE), excerptName)) {
+                        excerptData = rawExcerptData.uncompressedData();
+                        readExcerptHeader(partScore, excerptData, excerptName);
+                    }
+
+                    if (!partScore->isOpen()) {
+                        auto reader = [rawExcerptData, masterLinks, excerptName, mscVersion, ignoreVersionError](Score* score) {
+                            ScoreLoad sl;
+                            Ret ret = readExcerptScore(score, rawExcerptData.uncompressedData(), excerptName, *masterLinks,
+                                                       mscVersion, ignoreVersionError);
+                            return ret.success();
+                        };
+
+                        ex->setDeferredReader(reader);
+
+                        ex->setName(excerptName);
+                        masterScore->addExcerpt(ex);
+                        continue;
+                    }
+
+                    if (excerptData.empty()) {
+                        excerptData = rawExcerptData.uncompressedData();
+                    }
+                }
+            }
 
-            RetVal<IReaderPtr> reader = makeReader(masterScore->mscVersion(), ignoreVersionError);
-            if (!reader.ret) {
-                ret = reader.ret;
-                break;
+            if (excerptData.empty()) {
+                excerptData = mscReader.readExcerptFile(excerptName);
             }
 
-            Err err = reader.val->readScore(partScore, xml, &partReadInData);
-            ret =  make_ret(err);
+            ret = readExcerptScore(partScore, excerptData, excerptName, masterReadOutData.links, mscVersion, ignoreVersionError);
             if (!ret) {
                 break;
             }
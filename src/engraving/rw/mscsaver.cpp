@@ -45,8 +45,15 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
         return false;
     }
 
+    //! NOTE Incremental saving: the files of the scores that have not been modified since the last save
+    //! are copied from the previous version of the file (if the writer has it), without serialization.
+    //! Linked elements of the excerpts refer to the master score by the indexes,
+    //! which are assigned while writing the master score, so if the master score has been modified,
+    //! then all the excerpts must be written again.
+    const bool isMasterModified = onlySelection || score->modifiedSinceSave();
+
     // Write style of MasterScore
-    {
+    if (isMasterModified || !mscWriter.reuseStyleFile()) {
         //! NOTE The style is writing to a separate file only for the master score.
         //! At the moment, the style for the parts is still writing to the score file.
         ByteArray styleData;
@@ -57,16 +64,36 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
     }
 
     WriteInOutData masterWriteOutData;
+    bool isMasterSerialized = false;
+
+    auto serializeMasterScore = [&]() {
+        //! NOTE The links of the excerpts that are not read yet would be lost,
+        //! and the indexes of the links in their previous files would be invalid
+        score->loadDeferredExcerpts();
 
-    // Write MasterScore
-    {
         ByteArray scoreData;
         Buffer scoreBuf(&scoreData);
         scoreBuf.open(IODevice::ReadWrite);
 
         RWRegister::writer()->writeScore(score, &scoreBuf, onlySelection, &masterWriteOutData);
+        isMasterSerialized = true;
+
+        return scoreData;
+    };
+
+    // Write MasterScore
+    {
+        bool isAnyExcerptModified = false;
+        for (const Excerpt* excerpt : score->excerpts()) {
+            if (excerpt->excerptScore() && excerpt->excerptScore()->modifiedSinceSave()) {
+                isAnyExcerptModified = true;
+                break;
+            }
+        }
 
-        mscWriter.writeScoreFile(scoreData);
+        if (isMasterModified || isAnyExcerptModified || !mscWriter.reuseScoreFile()) {
+            mscWriter.writeScoreFile(serializeMasterScore());
+        }
     }
 
     // Write Excerpts
@@ -75,8 +102,11 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
             for (const Excerpt* excerpt : score->excerpts()) {
                 Score* partScore = excerpt->excerptScore();
                 if (partScore != score) {
+                    const bool reuseExcerpt = !isMasterModified && !partScore->modifiedSinceSave()
+                                              && mscWriter.reuseExcerptFile(excerpt->name());
+
                     // Write excerpt style
-                    {
+                    if (!reuseExcerpt || !mscWriter.reuseExcerptStyleFile(excerpt->name())) {
                         ByteArray excerptStyleData;
                         Buffer styleStyleBuf(&excerptStyleData);
                         styleStyleBuf.open(IODevice::WriteOnly);
@@ -86,7 +116,12 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
                     }
 
                     // Write excerpt
-                    {
+                    if (!reuseExcerpt) {
+                        //! NOTE The excerpt needs the write context of the master score
+                        if (!isMasterSerialized) {
+                            serializeMasterScore();
+                        }
+
                         ByteArray excerptData;
                         Buffer excerptBuf(&excerptData);
                         excerptBuf.open(IODevice::ReadWrite);
@@ -125,7 +160,7 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
 
     // Write thumbnail
     {
-        if (doCreateThumbnail && !score->pages().empty()) {
+        if (doCreateThumbnail && !score->pages().empty() && (isMasterModified || !mscWriter.reuseThumbnailFile())) {
             auto pixmap = score->createThumbnail();
 
             ByteArray ba;
@@ -146,8 +181,12 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
     return true;
 }
 
-bool MscSaver::exportPart(Score* partScore, MscWriter& mscWriter)
+bool MscSaver::exportPart(Score* partScore, MscWriter& mscWriter, bool midiMappingChecked, bool excerptLoaded)
 {
+    if (partScore->excerpt() && !excerptLoaded) {
+        partScore->masterScore()->loadDeferredExcerpt(partScore->excerpt());
+    }
+
     // Write excerpt style as main
     {
         ByteArray excerptStyleData;
@@ -164,7 +203,9 @@ bool MscSaver::exportPart(Score* partScore, MscWriter& mscWriter)
         Buffer excerptBuf(&excerptData);
         excerptBuf.open(IODevice::WriteOnly);
 
-        rw::RWRegister::writer()->writeScore(partScore, &excerptBuf, false);
+        rw::WriteInOutData out;
+        out.ctx.setMidiMappingChecked(midiMappingChecked);
+        rw::RWRegister::writer()->writeScore(partScore, &excerptBuf, false, &out);
 
         mscWriter.writeScoreFile(excerptData);
     }
@@ -38,7 +38,10 @@ public:
 
     bool writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySelection, bool doCreateThumbnail);
 
-    bool exportPart(Score* partScore, MscWriter& mscWriter);
+    //! NOTE With excerptLoaded the caller has already loaded the deferred excerpt of the part,
+    //! with midiMappingChecked it has already checked the midi mapping of the master score.
+    //! With both the export doesn't change the master score
+    bool exportPart(Score* partScore, MscWriter& mscWriter, bool midiMappingChecked = false, bool excerptLoaded = false);
 };
 }
 
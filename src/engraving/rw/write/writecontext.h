@@ -54,12 +54,14 @@ public:
     bool isMsczMode() const { return _msczMode; }
     bool writeTrack() const { return _writeTrack; }
     bool writePosition() const { return _writePosition; }
+    bool midiMappingChecked() const { return _midiMappingChecked; }
 
     void setClipboardmode(bool v) { _clipboardmode = v; }
     void setExcerptmode(bool v) { _excerptmode = v; }
     void setIsMsczMode(bool v) { _msczMode = v; }
     void setWriteTrack(bool v) { _writeTrack= v; }
     void setWritePosition(bool v) { _writePosition = v; }
+    void setMidiMappingChecked(bool v) { _midiMappingChecked = v; }
 
     void setFilter(SelectionFilter f) { _filter = f; }
     bool canWrite(const EngravingItem*) const;
@@ -76,6 +78,7 @@ public:
                && _msczMode == c._msczMode
                && _writeTrack == c._writeTrack
                && _writePosition == c._writePosition
+               && _midiMappingChecked == c._midiMappingChecked
                && _filter == c._filter
                && m_linksIndexer == c.m_linksIndexer
                && m_lidLocalIndices == c.m_lidLocalIndices;
@@ -95,6 +98,7 @@ private:
     bool _msczMode       { true };      // false if writing into *.msc file
     bool _writeTrack     { false };
     bool _writePosition  { false };
+    bool _midiMappingChecked { false }; // the caller has already called MasterScore::checkMidiMapping()
 
     SelectionFilter _filter;
 
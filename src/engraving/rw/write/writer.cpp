@@ -227,7 +227,9 @@ void Writer::write(Score* score, XmlWriter& xml, WriteContext& ctx, bool selecti
     }
 
     // Let's decide: write midi mapping to a file or not
-    score->masterScore()->checkMidiMapping();
+    if (!ctx.midiMappingChecked()) {
+        score->masterScore()->checkMidiMapping();
+    }
     for (const Part* part : score->m_parts) {
         if (!selectionOnly || ((score->staffIdx(part) >= staffStart) && (staffEnd >= score->staffIdx(part) + part->nstaves()))) {
             TWrite::write(part, xml, ctx);
@@ -87,3 +87,78 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_IncrementalWrite)
+{
+    //! CASE Writing a new version of the container, reusing the files from the previous one
+
+    //! GIVEN The previous version of the container
+    const ByteArray originScoreData("score");
+    const ByteArray originExcerptData("excerpt");
+    const ByteArray originStyleData("style");
+
+    ByteArray previousMsczData;
+    {
+        Buffer buf(&previousMsczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(originScoreData);
+        writer.addExcerptFile(u"Part1", originExcerptData);
+        writer.writeStyleFile(originStyleData);
+    }
+
+    //! DO Write a new version, where only the style has been changed
+    const ByteArray newStyleData("new style");
+
+    ByteArray msczData;
+    {
+        Buffer previousBuf(&previousMsczData);
+        MscReader::Params previousParams;
+        previousParams.device = &previousBuf;
+        previousParams.filePath = "simple1.mscz";
+        previousParams.mode = MscIoMode::Zip;
+
+        MscReader previousReader(previousParams);
+        previousReader.open();
+
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+        params.previousVersion = &previousReader;
+
+        MscWriter writer(params);
+        writer.open();
+
+        EXPECT_TRUE(writer.reuseScoreFile());
+        EXPECT_TRUE(writer.reuseExcerptFile(u"Part1"));
+        EXPECT_FALSE(writer.reuseExcerptFile(u"Part2"));
+        writer.writeStyleFile(newStyleData);
+    }
+
+    //! CHECK Read and compare with origin
+    {
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        EXPECT_EQ(reader.readScoreFile(), originScoreData);
+        EXPECT_EQ(reader.readExcerptFile(u"Part1"), originExcerptData);
+        EXPECT_EQ(reader.readStyleFile(), newStyleData);
+
+        std::vector<String> excerpts = reader.excerptNames();
+        EXPECT_EQ(excerpts.size(), 1);
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/painter.h"
+#include "draw/utils/drawdatajson.h"
+
+#include "dom/masterscore.h"
+#include "dom/page.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String ALL_ELEMENTS_DATA_DIR("all_elements_data/");
+
+class Engraving_PaintTests : public ::testing::Test
+{
+public:
+    static ByteArray paintPage(Score* score, int pageIndex)
+    {
+        auto provider = std::make_shared<draw::BufferedPaintProvider>();
+        draw::Painter painter(provider, "paint_tests");
+
+        IScoreRenderer::PaintOptions opt;
+        opt.fromPage = pageIndex;
+        opt.toPage = pageIndex;
+        opt.isPrinting = true;
+        opt.deviceDpi = draw::DrawData::CANVAS_DPI;
+
+        EngravingItem::renderer()->paintScore(&painter, score, opt);
+        painter.endDraw();
+
+        return draw::DrawDataJson::toJson(provider->drawData());
+    }
+};
+
+//---------------------------------------------------------
+//   concurrentPages
+//    Pages painted concurrently are identical to the pages painted one after another
+//---------------------------------------------------------
+
+TEST_F(Engraving_PaintTests, concurrentPages)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    const int pageCount = static_cast<int>(score->npages());
+    ASSERT_GT(pageCount, 0);
+
+    std::vector<ByteArray> sequential;
+    for (int i = 0; i < pageCount; ++i) {
+        sequential.push_back(paintPage(score, i));
+    }
+
+    std::vector<std::future<ByteArray> > concurrent;
+    for (int i = 0; i < pageCount; ++i) {
+        concurrent.push_back(std::async(std::launch::async, &Engraving_PaintTests::paintPage, score, i));
+    }
+
+    for (int i = 0; i < pageCount; ++i) {
+        EXPECT_EQ(concurrent[i].get(), sequential[i]) << "page " << i;
+    }
+
+    delete score;
+}
@@ -22,6 +22,10 @@
 
 #include <gtest/gtest.h>
 
+#include "io/buffer.h"
+
+#include "compat/scoreaccess.h"
+
 #include "dom/breath.h"
 #include "dom/chord.h"
 #include "dom/chordline.h"
@@ -36,6 +40,11 @@
 #include "dom/note.h"
 #include "dom/part.h"
 #include "dom/segment.h"
+#include "infrastructure/localfileinfoprovider.h"
+#include "infrastructure/mscreader.h"
+#include "infrastructure/mscwriter.h"
+#include "rw/mscloader.h"
+#include "rw/mscsaver.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
@@ -1172,3 +1181,65 @@ TEST_F(Engraving_PartsTests, staffStyles)
 }
 
 #endif
+
+//---------------------------------------------------------
+//   deferredExcerpts
+//    the excerpts that are not open are read on demand
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, deferredExcerpts)
+{
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+    ASSERT_TRUE(score);
+    createParts(score);
+
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "part-all.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        EXPECT_TRUE(MscSaver().writeMscz(score, writer, false, false));
+    }
+
+    delete score;
+
+    Buffer buf(&msczData);
+    MscReader::Params params;
+    params.device = &buf;
+    params.filePath = "part-all.mscz";
+    params.mode = MscIoMode::Zip;
+
+    MscReader reader(params);
+    reader.open();
+
+    MasterScore* loadedScore = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    loadedScore->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>("part-all.mscz"));
+
+    SettingsCompat settingsCompat;
+    EXPECT_TRUE(MscLoader().loadMscz(loadedScore, reader, settingsCompat, false));
+
+    ASSERT_EQ(loadedScore->excerpts().size(), 2);
+    for (const Excerpt* excerpt : loadedScore->excerpts()) {
+        EXPECT_TRUE(excerpt->isDeferred());
+        EXPECT_FALSE(excerpt->isEmpty());
+        EXPECT_TRUE(excerpt->excerptScore()->staves().empty());
+    }
+
+    // any command reads the excerpts first
+    loadedScore->startCmd();
+    loadedScore->endCmd();
+
+    for (const Excerpt* excerpt : loadedScore->excerpts()) {
+        EXPECT_FALSE(excerpt->isDeferred());
+        EXPECT_EQ(excerpt->excerptScore()->staves().size(), 1);
+        EXPECT_EQ(excerpt->parts().size(), 1);
+    }
+
+    delete loadedScore;
+}
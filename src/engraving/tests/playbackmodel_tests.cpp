@@ -116,6 +116,65 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat)
     EXPECT_EQ(result.size(), expectedSize);
 }
 
+/**
+ * @brief PlaybackModelTests_SimpleRepeat_Repeated_Events
+ * @details The same score as in SimpleRepeat. Measures 2 and 3 are played twice,
+ *          so that their events should be the same on every repeat, just moved in time
+ */
+TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Repeated_Events)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+    ASSERT_TRUE(part);
+
+    // [GIVEN] Every quarter note lasts 500ms at 120 bpm, measures 2 and 3 are repeated after 8 quarter notes
+    constexpr timestamp_t QUARTER_DURATION = 500000;
+    constexpr int REPEATED_QUARTERS_FROM = 4;
+    constexpr int REPEATED_QUARTERS_COUNT = 8;
+
+    // [WHEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [WHEN] The playback model requested to be loaded
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.load(score);
+
+    const PlaybackEventsMap& result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+    ASSERT_EQ(result.size(), 24);
+
+    // [THEN] The events follow each other without gaps, including the repeated ones
+    timestamp_t expectedTimestamp = 0;
+    for (const auto& pair : result) {
+        EXPECT_EQ(pair.first, expectedTimestamp);
+        ASSERT_EQ(pair.second.size(), 1);
+
+        const NoteEvent& noteEvent = std::get<NoteEvent>(pair.second.front());
+        EXPECT_EQ(noteEvent.arrangementCtx().nominalTimestamp, expectedTimestamp);
+
+        expectedTimestamp += QUARTER_DURATION;
+    }
+
+    // [THEN] The repeated events match the events played at the first time
+    for (int i = REPEATED_QUARTERS_FROM; i < REPEATED_QUARTERS_FROM + REPEATED_QUARTERS_COUNT; ++i) {
+        const NoteEvent& first = std::get<NoteEvent>(result.at(i * QUARTER_DURATION).front());
+        const NoteEvent& repeated = std::get<NoteEvent>(result.at((i + REPEATED_QUARTERS_COUNT) * QUARTER_DURATION).front());
+
+        EXPECT_EQ(repeated.arrangementCtx().nominalDuration, first.arrangementCtx().nominalDuration);
+        EXPECT_EQ(repeated.pitchCtx(), first.pitchCtx());
+        EXPECT_EQ(repeated.expressionCtx().nominalDynamicLevel, first.expressionCtx().nominalDynamicLevel);
+
+        for (const auto& articulation : repeated.expressionCtx().articulations) {
+            EXPECT_EQ(articulation.second.meta.timestamp, repeated.arrangementCtx().nominalTimestamp);
+        }
+    }
+}
+
 /**
  * @brief PlaybackModelTests_Two_Ending_Repeat
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 6 measures
@@ -822,3 +881,51 @@ TEST_F(Engraving_PlaybackModelTests, Playback_Setup_Data_MultiInstrument)
         }
     }
 }
+
+/**
+ * @brief PlaybackModelTests_Load_Tracks_Concurrently
+ * @details In this case we're loading the playback model of a score with 12 instruments twice:
+ *          rendering the tracks one after another and rendering the parts concurrently.
+ *          The events of every track and the set of the published tracks should be the same in both cases
+ */
+TEST_F(Engraving_PlaybackModelTests, Load_Tracks_Concurrently)
+{
+    // [GIVEN] Score with 12 instruments
+    Score* score = ScoreRW::readScore(
+        PLAYBACK_MODEL_TEST_FILES_DIR + "playback_setup_instruments/playback_setup_instruments.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 12);
+
+    // [GIVEN] The articulation profiles repository will be returning the default profile for every family
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [WHEN] The playback model is loaded with the tracks rendered one after another
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.load(score);
+
+    // [WHEN] The playback model is loaded with the parts rendered concurrently
+    PlaybackModel concurrentModel;
+    concurrentModel.setprofilesRepository(m_repositoryMock);
+    concurrentModel.setLoadTracksConcurrently(true);
+
+    InstrumentTrackIdSet addedTracks;
+    concurrentModel.trackAdded().onReceive(this, [&addedTracks](const InstrumentTrackId& trackId) {
+        EXPECT_TRUE(addedTracks.insert(trackId).second);
+    });
+
+    concurrentModel.load(score);
+
+    // [THEN] Every track has been published once
+    EXPECT_EQ(addedTracks, model.existingTrackIdSet());
+    EXPECT_EQ(concurrentModel.existingTrackIdSet(), model.existingTrackIdSet());
+
+    // [THEN] The events of every track match
+    for (const InstrumentTrackId& trackId : model.existingTrackIdSet()) {
+        const PlaybackEventsMap& expected = model.resolveTrackPlaybackData(trackId).originEvents;
+        const PlaybackEventsMap& actual = concurrentModel.resolveTrackPlaybackData(trackId).originEvents;
+
+        EXPECT_EQ(actual, expected);
+    }
+}
@@ -256,3 +256,54 @@ TEST_F(Engraving_TempoMapTests, GRADUAL_TEMPO_CHANGE_DOESNT_OVERWRITE_OTHER_TEMP
         EXPECT_TRUE(RealIsEqual(RealRound(tempoMap->at(pair.first).tempo.val, 2), RealRound(pair.second.val, 2)));
     }
 }
+
+/**
+ * @brief TempoMapTests_TICK_TIME_CONVERSION
+ * @details A long accelerando written as thousands of tempo events.
+ *          Ticks and times should be converted through the tempo map index the same way
+ *          as walking the tempo events one by one
+ */
+TEST_F(Engraving_TempoMapTests, TICK_TIME_CONVERSION)
+{
+    // [GIVEN] Tempo map with a tempo change on every 8th note, from 60 to 180 BPM
+    constexpr int eventCount = 4000;
+    constexpr int eventDistance = Constants::DIVISION / 2;
+
+    TempoMap tempoMap;
+    for (int i = 0; i < eventCount; ++i) {
+        tempoMap.setTempo(i * eventDistance, BeatsPerSecond::fromBPM(BeatsPerMinute(60.0 + 120.0 * i / eventCount)));
+    }
+
+    // [GIVEN] Expected times of the tempo events, accumulated event by event
+    std::vector<double> expectedTimes;
+    double time = 0.0;
+    for (const auto& pair : tempoMap) {
+        expectedTimes.push_back(time);
+        time += eventDistance / (Constants::DIVISION * pair.second.tempo.val);
+    }
+
+    // [WHEN] We convert the ticks in the middle of each tempo event one by one and all at once
+    std::vector<int> ticks;
+    for (int i = 0; i < eventCount; ++i) {
+        ticks.push_back(i * eventDistance + eventDistance / 2);
+    }
+
+    std::vector<double> times = tempoMap.ticks2times(ticks);
+    ASSERT_EQ(times.size(), ticks.size());
+
+    // [THEN] Both conversions match the accumulated times and convert back to the same ticks
+    for (int i = 0; i < eventCount; ++i) {
+        double halfEvent = eventDistance / 2 / (Constants::DIVISION * tempoMap.tempo(ticks[i]).val);
+
+        EXPECT_NEAR(tempoMap.tick2time(ticks[i]), expectedTimes[i] + halfEvent, 1e-9);
+        EXPECT_DOUBLE_EQ(times[i], tempoMap.tick2time(ticks[i]));
+        EXPECT_EQ(tempoMap.time2tick(times[i]), ticks[i]);
+    }
+
+    // [THEN] Unsorted ticks are converted as well
+    std::vector<int> unsortedTicks = { ticks[100], ticks[10], ticks[3000], 0 };
+    std::vector<double> unsortedTimes = tempoMap.ticks2times(unsortedTicks);
+    for (size_t i = 0; i < unsortedTicks.size(); ++i) {
+        EXPECT_DOUBLE_EQ(unsortedTimes[i], tempoMap.tick2time(unsortedTicks[i]));
+    }
+}
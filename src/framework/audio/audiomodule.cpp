@@ -46,6 +46,7 @@
 
 // synthesizers
 #include "internal/synthesizers/fluidsynth/fluidresolver.h"
+#include "internal/synthesizers/fluidsynth/sfsamplesdiskcache.h"
 #include "internal/synthesizers/synthresolver.h"
 
 #include "internal/fx/fxresolver.h"
@@ -295,6 +296,8 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
         AudioEngine::instance()->setSampleRate(activeSpec.sampleRate);
         AudioEngine::instance()->setReadBufferSize(activeSpec.samples);
 
+        SoundFontSamplesDiskCache::init(m_configuration->soundFontSamplesCachePath());
+
         auto fluidResolver = std::make_shared<FluidResolver>();
         m_synthResolver->registerResolver(AudioSourceType::Fluid, fluidResolver);
         m_synthResolver->init(m_configuration->defaultAudioInputParams());
@@ -305,6 +308,7 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
 
     auto workerLoopBody = [this]() {
         ONLY_AUDIO_WORKER_THREAD;
+        m_playbackFacade->processCommands();
         m_audioBuffer->forward();
     };
 
@@ -23,6 +23,8 @@
 #ifndef MU_AUDIO_AUDIOTYPES_H
 #define MU_AUDIO_AUDIOTYPES_H
 
+#include <array>
+#include <atomic>
 #include <variant>
 #include <memory>
 #include <set>
@@ -97,6 +99,13 @@ using AudioResourceVendor = std::string;
 using AudioResourceAttributes = std::map<String, String>;
 using AudioUnitConfig = std::map<std::string, std::string>;
 
+//! NOTE Marks a synth instance that renders ahead of the playback, such an instance must not produce any output except audio
+static const std::string PRE_RENDER_INSTANCE_CONFIG_KEY("preRenderInstance");
+
+//! NOTE The number of synth instances the MIDI channels of a Fluid track are split across, rendered in parallel.
+//! Set per track, the tracks without it use IAudioConfiguration::fluidRenderShards()
+static const std::string FLUID_RENDER_SHARDS_CONFIG_KEY("fluidRenderShards");
+
 static const String PLAYBACK_SETUP_DATA_ATTRIBUTE("playbackSetupData");
 static const String CATEGORIES_ATTRIBUTE("categories");
 
@@ -327,38 +336,64 @@ struct AudioSignalVal {
     volume_dbfs_t pressure = 0.f;
 };
 
-using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
+//! NOTE The latest signal values of the audio channels of a mixer channel.
+//! The audio worker writes them on every block, the UI polls them at its own rate,
+//! so no message goes between the threads. Nothing is measured while nobody observes the meter
+class AudioSignalsMeter
+{
+public:
+    static constexpr audioch_t MAX_AUDIO_CHANNELS_COUNT = 2;
 
-struct AudioSignalsNotifier {
     void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
     {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
-
-        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
-
-        if (RealIsEqual(signalVal.pressure, validatedPressure)) {
+        if (audioChNumber >= MAX_AUDIO_CHANNELS_COUNT) {
             return;
         }
 
-        if (std::abs(signalVal.pressure - validatedPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
-            return;
+        Values& values = m_values[audioChNumber];
+        values.amplitude.store(newAmplitude, std::memory_order_relaxed);
+        values.pressure.store(std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL), std::memory_order_relaxed);
+    }
+
+    AudioSignalVal signalValue(const audioch_t audioChNumber) const
+    {
+        if (audioChNumber >= MAX_AUDIO_CHANNELS_COUNT) {
+            return AudioSignalVal();
         }
 
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
+        const Values& values = m_values[audioChNumber];
+        return { values.amplitude.load(std::memory_order_relaxed), values.pressure.load(std::memory_order_relaxed) };
+    }
 
-        audioSignalChanges.send(audioChNumber, signalVal);
+    bool isObserved() const
+    {
+        return m_observersCount.load(std::memory_order_relaxed) > 0;
+    }
+
+    void addObserver()
+    {
+        ++m_observersCount;
     }
 
-    AudioSignalChanges audioSignalChanges;
+    void removeObserver()
+    {
+        --m_observersCount;
+    }
 
 private:
-    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 2.5f;
     static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    struct Values {
+        std::atomic<float> amplitude { 0.f };
+        std::atomic<volume_dbfs_t> pressure { MINIMUM_OPERABLE_DBFS_LEVEL };
+    };
+
+    std::array<Values, MAX_AUDIO_CHANNELS_COUNT> m_values;
+    std::atomic<int> m_observersCount { 0 };
 };
 
+using AudioSignalsMeterPtr = std::shared_ptr<AudioSignalsMeter>;
+
 enum class PlaybackStatus {
     Stopped = 0,
     Paused,
@@ -52,6 +52,45 @@ inline AudioPluginType audioPluginTypeFromCategoriesString(const String& categor
 
     return AudioPluginType::Undefined;
 }
+
+//! NOTE While playing, the synthesizers derive their block boundaries from the samples rendered since the last position change,
+//! so the events land on the same samples whatever the block size is, and the position doesn't drift
+struct SynthBlock
+{
+    samples_t startSample = 0;
+    msecs_t startMsecs = 0;
+    msecs_t durationMsecs = 0;
+    sample_rate_t sampleRate = 0;
+};
+
+inline msecs_t sampleToMsecs(const samples_t sample, const sample_rate_t sampleRate)
+{
+    //! NOTE Rounded up, so that an event belongs to the block of the sample msecsToSample() gives for it
+    return static_cast<msecs_t>((sample * 1000000 + sampleRate - 1) / sampleRate);
+}
+
+inline samples_t msecsToSample(const msecs_t msecs, const sample_rate_t sampleRate)
+{
+    return static_cast<samples_t>(msecs) * sampleRate / 1000000;
+}
+
+inline SynthBlock synthBlock(const samples_t renderedSamples, const samples_t samplesPerChannel, const sample_rate_t sampleRate)
+{
+    SynthBlock block;
+    block.startSample = renderedSamples;
+    block.startMsecs = sampleToMsecs(renderedSamples, sampleRate);
+    block.durationMsecs = sampleToMsecs(renderedSamples + samplesPerChannel, sampleRate) - block.startMsecs;
+    block.sampleRate = sampleRate;
+
+    return block;
+}
+
+//! NOTE The offset of an event in the block, the event time is relative to the block start
+inline samples_t synthEventOffset(const SynthBlock& block, const msecs_t eventMsecs)
+{
+    const samples_t eventSample = msecsToSample(block.startMsecs + eventMsecs, block.sampleRate);
+    return eventSample > block.startSample ? eventSample - block.startSample : 0;
+}
 }
 
 #endif // MU_AUDIO_AUDIOUTILS_H
@@ -53,6 +53,13 @@ public:
     virtual async::Notification driverBufferSizeChanged() const = 0;
     virtual samples_t renderStep() const = 0;
 
+    virtual bool isPreRenderEnabled() const = 0;
+    virtual void setPreRenderEnabled(bool enabled) = 0;
+
+    //! NOTE The number of render shards of the Fluid tracks that don't set their own, see FLUID_RENDER_SHARDS_CONFIG_KEY
+    virtual int fluidRenderShards() const = 0;
+    virtual void setFluidRenderShards(int shards) = 0;
+
     virtual unsigned int sampleRate() const = 0;
     virtual void setSampleRate(unsigned int sampleRate) = 0;
     virtual async::Notification sampleRateChanged() const = 0;
@@ -66,6 +73,8 @@ public:
     virtual async::Channel<io::paths_t> soundFontDirectoriesChanged() const = 0;
 
     virtual io::path_t knownAudioPluginsFilePath() const = 0;
+    virtual io::path_t soundFontSamplesCachePath() const = 0;
+    virtual io::path_t soundFontIndexFilePath() const = 0;
 };
 }
 
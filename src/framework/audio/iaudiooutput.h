@@ -48,8 +48,8 @@ public:
 
     virtual async::Promise<AudioResourceMetaList> availableOutputResources() const = 0;
 
-    virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
-    virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
+    virtual async::Promise<AudioSignalsMeterPtr> signalsMeter(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
+    virtual async::Promise<AudioSignalsMeterPtr> masterSignalsMeter() const = 0;
 
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
@@ -23,6 +23,7 @@
 #ifndef MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
+#include <algorithm>
 #include <map>
 #include <set>
 
@@ -143,11 +144,13 @@ public:
         return std::prev(upper)->second;
     }
 
-    EventSequence eventsToBePlayed(const msecs_t nextMsecs)
+    //! NOTE Returns the events of the next nextMsecs, grouped by their offset from the current playback position,
+    //! so that the synths are able to play each group at its exact place in the block
+    EventSequenceMap eventsToBePlayed(const msecs_t nextMsecs)
     {
         ONLY_AUDIO_WORKER_THREAD;
 
-        EventSequence result;
+        EventSequenceMap result;
 
         if (!m_isActive) {
             handleOffStream(result, nextMsecs);
@@ -158,10 +161,11 @@ public:
             return result;
         }
 
+        const msecs_t from = m_playbackPosition;
         m_playbackPosition += nextMsecs;
 
-        handleMainStream(result);
-        handleDynamicChanges(result);
+        handleMainStream(result, from);
+        handleDynamicChanges(result, from);
 
         return result;
     }
@@ -189,14 +193,14 @@ protected:
         m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
     }
 
-    void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
+    void handleOffStream(EventSequenceMap& result, const msecs_t nextMsecs)
     {
         if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.cend()) {
             return;
         }
 
         if (m_currentOffSequenceIt->first <= nextMsecs) {
-            result = m_currentOffSequenceIt->second;
+            result.emplace(0, m_currentOffSequenceIt->second);
             m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
         } else {
             auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
@@ -206,27 +210,24 @@ protected:
         }
     }
 
-    void handleMainStream(EventSequence& result)
+    void handleMainStream(EventSequenceMap& result, const msecs_t from)
     {
-        if (m_currentMainSequenceIt->first <= m_playbackPosition) {
-            result.insert(m_currentMainSequenceIt->second.cbegin(),
-                          m_currentMainSequenceIt->second.cend());
-
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
-        }
+        collectEvents(result, m_mainStreamEvents, m_currentMainSequenceIt, from);
     }
 
-    void handleDynamicChanges(EventSequence& result)
+    void handleDynamicChanges(EventSequenceMap& result, const msecs_t from)
     {
-        if (m_dynamicEvents.empty() || m_currentDynamicsIt == m_dynamicEvents.cend()) {
-            return;
-        }
+        collectEvents(result, m_dynamicEvents, m_currentDynamicsIt, from);
+    }
 
-        if (m_currentDynamicsIt->first <= m_playbackPosition) {
-            result.insert(m_currentDynamicsIt->second.cbegin(),
-                          m_currentDynamicsIt->second.cend());
+    //! NOTE Takes all the events in [from, m_playbackPosition), the events before from are played at once
+    void collectEvents(EventSequenceMap& result, const EventSequenceMap& events, SequenceIterator& it, const msecs_t from)
+    {
+        while (it != events.cend() && it->first < m_playbackPosition) {
+            EventSequence& sequence = result[std::max<msecs_t>(it->first - from, 0)];
+            sequence.insert(it->second.cbegin(), it->second.cend());
 
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+            it = std::next(it);
         }
     }
 
@@ -41,6 +41,8 @@ static const Settings::Key AUDIO_API_KEY("audio", "io/audioApi");
 static const Settings::Key AUDIO_OUTPUT_DEVICE_ID_KEY("audio", "io/outputDevice");
 static const Settings::Key AUDIO_BUFFER_SIZE_KEY("audio", "io/bufferSize");
 static const Settings::Key AUDIO_SAMPLE_RATE_KEY("audio", "io/sampleRate");
+static const Settings::Key AUDIO_PRE_RENDER_KEY("audio", "io/preRenderAhead");
+static const Settings::Key AUDIO_FLUID_RENDER_SHARDS_KEY("audio", "io/fluidRenderShards");
 
 static const Settings::Key USER_SOUNDFONTS_PATHS("midi", "application/paths/mySoundfonts");
 
@@ -72,6 +74,9 @@ void AudioConfiguration::init()
         m_driverSampleRateChanged.notify();
     });
 
+    settings()->setDefaultValue(AUDIO_PRE_RENDER_KEY, Val(false));
+    settings()->setDefaultValue(AUDIO_FLUID_RENDER_SHARDS_KEY, Val(1));
+
     settings()->setDefaultValue(USER_SOUNDFONTS_PATHS, Val(globalConfiguration()->userDataPath() + "/SoundFonts"));
     settings()->valueChanged(USER_SOUNDFONTS_PATHS).onReceive(nullptr, [this](const Val&) {
         m_soundFontDirsChanged.send(soundFontDirectories());
@@ -144,6 +149,26 @@ samples_t AudioConfiguration::renderStep() const
     return 512;
 }
 
+bool AudioConfiguration::isPreRenderEnabled() const
+{
+    return settings()->value(AUDIO_PRE_RENDER_KEY).toBool();
+}
+
+void AudioConfiguration::setPreRenderEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_PRE_RENDER_KEY, Val(enabled));
+}
+
+int AudioConfiguration::fluidRenderShards() const
+{
+    return settings()->value(AUDIO_FLUID_RENDER_SHARDS_KEY).toInt();
+}
+
+void AudioConfiguration::setFluidRenderShards(int shards)
+{
+    settings()->setSharedValue(AUDIO_FLUID_RENDER_SHARDS_KEY, Val(shards));
+}
+
 unsigned int AudioConfiguration::sampleRate() const
 {
     return settings()->value(AUDIO_SAMPLE_RATE_KEY).toInt();
@@ -195,3 +220,13 @@ io::path_t AudioConfiguration::knownAudioPluginsFilePath() const
 {
     return globalConfiguration()->userAppDataPath() + "/known_audio_plugins.json";
 }
+
+io::path_t AudioConfiguration::soundFontSamplesCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/soundfont_samples_cache";
+}
+
+io::path_t AudioConfiguration::soundFontIndexFilePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/soundfont_index.json";
+}
@@ -21,6 +21,12 @@
  */
 #include "soundfontrepository.h"
 
+#include <mutex>
+#include <set>
+
+#include "concurrency/parallelfor.h"
+#include "serialization/json.h"
+
 #include "log.h"
 #include "translation.h"
 
@@ -31,8 +37,21 @@ using namespace mu::audio::synth;
 using namespace mu::framework;
 using namespace mu::async;
 
+static constexpr int SOUNDFONT_INDEX_VERSION = 1;
+
+SoundFontRepository::~SoundFontRepository()
+{
+    stopParsing();
+}
+
 void SoundFontRepository::init()
 {
+    m_soundFontParsed.onReceive(this, [this](size_t generation, const SoundFontPath& path, const RetVal<SoundFontMeta>& meta) {
+        onSoundFontParsed(generation, path, meta);
+    });
+
+    readIndex();
+
     loadSoundFonts();
     configuration()->soundFontDirectoriesChanged().onReceive(this, [this](const io::paths_t&) {
         loadSoundFonts();
@@ -43,14 +62,19 @@ void SoundFontRepository::loadSoundFonts()
 {
     TRACEFUNC;
 
-    m_soundFontPaths.clear();
+    stopParsing();
 
-    SoundFontsMap oldSoundFonts;
-    m_soundFonts.swap(oldSoundFonts);
+    m_soundFontPaths.clear();
+    m_soundFonts.clear();
 
     static const std::vector<std::string> filters = { "*.sf2",  "*.sf3" };
     io::paths_t dirs = configuration()->soundFontDirectories();
 
+    SoundFontPaths changedSoundFonts;
+    bool indexChanged = false;
+
+    const std::string defaultSoundFontName = configuration()->defaultAudioInputParams().resourceMeta.id;
+
     for (const io::path_t& dir : dirs) {
         RetVal<io::paths_t> soundFonts = fileSystem()->scanFiles(dir, filters);
         if (!soundFonts.ret) {
@@ -59,21 +83,63 @@ void SoundFontRepository::loadSoundFonts()
         }
 
         for (const SoundFontPath& soundFont : soundFonts.val) {
-            loadSoundFont(soundFont, oldSoundFonts);
+            m_soundFontPaths.push_back(soundFont);
+
+            //! NOTE Only the fonts that are new or changed since they were indexed need to be parsed.
+            //! The fonts loaded before are in the index too, so a font changed since then is parsed again
+            IndexEntry stamp = indexEntryStamp(soundFont);
+
+            auto indexIt = m_index.find(soundFont);
+            if (indexIt != m_index.cend()
+                && indexIt->second.fileSize == stamp.fileSize
+                && indexIt->second.lastModified == stamp.lastModified) {
+                m_soundFonts.insert_or_assign(soundFont, indexIt->second.meta);
+                continue;
+            }
+
+            //! NOTE The tracks are resolved with the default SoundFont before the background parsing could deliver it,
+            //! so that one is parsed right away. The tracks that use other fonts get them when they are parsed
+            if (io::completeBasename(soundFont).toStdString() == defaultSoundFontName) {
+                RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(soundFont);
+                if (meta.ret) {
+                    stamp.meta = meta.val;
+                    m_index.insert_or_assign(soundFont, std::move(stamp));
+                    m_soundFonts.insert_or_assign(soundFont, std::move(meta.val));
+                    indexChanged = true;
+                } else {
+                    LOGE() << "Failed parse SoundFont presets for " << soundFont << ": " << meta.ret.toString();
+                }
+                continue;
+            }
+
+            if (m_pendingIndexEntries.insert_or_assign(soundFont, std::move(stamp)).second) {
+                changedSoundFonts.push_back(soundFont);
+            }
         }
     }
+
+    const std::set<SoundFontPath> existingSoundFonts(m_soundFontPaths.cbegin(), m_soundFontPaths.cend());
+
+    for (auto it = m_index.begin(); it != m_index.end();) {
+        if (existingSoundFonts.find(it->first) == existingSoundFonts.cend()) {
+            it = m_index.erase(it);
+            indexChanged = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if (!changedSoundFonts.empty()) {
+        startParsing(changedSoundFonts);
+    } else if (indexChanged) {
+        writeIndex();
+    }
 }
 
-void SoundFontRepository::loadSoundFont(const SoundFontPath& path, const SoundFontsMap& oldSoundFonts)
+void SoundFontRepository::loadSoundFont(const SoundFontPath& path)
 {
     m_soundFontPaths.push_back(path);
 
-    auto it = oldSoundFonts.find(path);
-    if (it != oldSoundFonts.cend()) {
-        m_soundFonts.insert(*it);
-        return;
-    }
-
     RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(path);
 
     if (!meta.ret) {
@@ -81,9 +147,190 @@ void SoundFontRepository::loadSoundFont(const SoundFontPath& path, const SoundFo
         return;
     }
 
+    IndexEntry entry = indexEntryStamp(path);
+    entry.meta = meta.val;
+    m_index.insert_or_assign(path, std::move(entry));
+    writeIndex();
+
     m_soundFonts.insert_or_assign(path, std::move(meta.val));
 }
 
+SoundFontRepository::IndexEntry SoundFontRepository::indexEntryStamp(const SoundFontPath& path) const
+{
+    IndexEntry entry;
+    entry.fileSize = fileSystem()->fileSize(path).val;
+    entry.lastModified = fileSystem()->lastModified(path);
+
+    return entry;
+}
+
+void SoundFontRepository::startParsing(const SoundFontPaths& paths)
+{
+    m_abortParsing = false;
+
+    //! NOTE The results of a stopped parsing may still be queued to the main thread,
+    //! the generation lets them be recognized and ignored
+    const size_t generation = ++m_parsingGeneration;
+    async::Channel<size_t, SoundFontPath, RetVal<SoundFontMeta> > soundFontParsed = m_soundFontParsed;
+
+    m_parsingThread = std::thread([this, paths, generation, soundFontParsed]() mutable {
+        std::mutex sendMutex;
+
+        parallelFor(0, paths.size(), [&](size_t i) {
+            if (m_abortParsing) {
+                return;
+            }
+
+            RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(paths.at(i));
+
+            std::lock_guard lock(sendMutex);
+            soundFontParsed.send(generation, paths.at(i), meta);
+        });
+    });
+}
+
+void SoundFontRepository::stopParsing()
+{
+    if (m_parsingThread.joinable()) {
+        m_abortParsing = true;
+        m_parsingThread.join();
+    }
+
+    m_pendingIndexEntries.clear();
+}
+
+void SoundFontRepository::onSoundFontParsed(size_t generation, const SoundFontPath& path, const RetVal<SoundFontMeta>& meta)
+{
+    if (generation != m_parsingGeneration) {
+        return;
+    }
+
+    auto it = m_pendingIndexEntries.find(path);
+    if (it == m_pendingIndexEntries.end()) {
+        return;
+    }
+
+    IndexEntry entry = std::move(it->second);
+    m_pendingIndexEntries.erase(it);
+
+    if (meta.ret) {
+        entry.meta = meta.val;
+        m_index.insert_or_assign(path, std::move(entry));
+        m_soundFonts.insert_or_assign(path, meta.val);
+        m_soundFontsChanged.notify();
+    } else {
+        LOGE() << "Failed parse SoundFont presets for " << path << ": " << meta.ret.toString();
+    }
+
+    if (m_pendingIndexEntries.empty()) {
+        writeIndex();
+    }
+}
+
+void SoundFontRepository::readIndex()
+{
+    TRACEFUNC;
+
+    m_index.clear();
+
+    io::path_t indexPath = configuration()->soundFontIndexFilePath();
+    if (!fileSystem()->exists(indexPath)) {
+        return;
+    }
+
+    RetVal<ByteArray> file = fileSystem()->readFile(indexPath);
+    if (!file.ret) {
+        LOGE() << file.ret.toString();
+        return;
+    }
+
+    std::string err;
+    JsonDocument json = JsonDocument::fromJson(file.val, &err);
+    if (!err.empty()) {
+        LOGE() << err;
+        return;
+    }
+
+    JsonObject root = json.rootObject();
+    if (root.value("version").toInt() != SOUNDFONT_INDEX_VERSION) {
+        return;
+    }
+
+    JsonArray soundFonts = root.value("soundFonts").toArray();
+
+    for (size_t i = 0; i < soundFonts.size(); ++i) {
+        JsonObject object = soundFonts.at(i).toObject();
+
+        IndexEntry entry;
+        entry.fileSize = static_cast<uint64_t>(object.value("size").toDouble());
+        entry.lastModified = DateTime::fromStringISOFormat(object.value("lastModified").toString());
+        entry.meta.path = object.value("path").toString();
+
+        JsonArray presets = object.value("presets").toArray();
+        for (size_t j = 0; j < presets.size(); ++j) {
+            JsonObject presetObject = presets.at(j).toObject();
+
+            SoundFontPreset preset;
+            preset.program = midi::Program(presetObject.value("bank").toInt(), presetObject.value("program").toInt());
+            preset.name = presetObject.value("name").toStdString();
+
+            entry.meta.presets.push_back(std::move(preset));
+        }
+
+        m_index.insert_or_assign(entry.meta.path, std::move(entry));
+    }
+}
+
+mu::Ret SoundFontRepository::writeIndex() const
+{
+    TRACEFUNC;
+
+    JsonArray soundFonts;
+
+    for (const auto& pair : m_index) {
+        const IndexEntry& entry = pair.second;
+
+        JsonArray presets;
+        for (const SoundFontPreset& preset : entry.meta.presets) {
+            JsonObject presetObject;
+            presetObject.set("bank", preset.program.bank);
+            presetObject.set("program", preset.program.program);
+            presetObject.set("name", preset.name);
+
+            presets << presetObject;
+        }
+
+        JsonObject object;
+        object.set("path", pair.first.toStdString());
+        object.set("size", static_cast<double>(entry.fileSize));
+        object.set("lastModified", entry.lastModified.toString());
+        object.set("presets", presets);
+
+        soundFonts << object;
+    }
+
+    JsonObject root;
+    root.set("version", SOUNDFONT_INDEX_VERSION);
+    root.set("soundFonts", soundFonts);
+
+    //! NOTE The index is written to a temporary file and renamed, so that an interrupted write
+    //! leaves the old index or no index, but never a partly written one
+    const io::path_t indexPath = configuration()->soundFontIndexFilePath();
+    const io::path_t tempPath = indexPath + ".tmp";
+
+    Ret ret = fileSystem()->writeFile(tempPath, JsonDocument(root).toJson(JsonDocument::Format::Compact));
+    if (ret) {
+        ret = fileSystem()->move(tempPath, indexPath, true /* replace */);
+    }
+
+    if (!ret) {
+        LOGE() << "Failed to write the SoundFont index: " << ret.toString();
+        fileSystem()->remove(tempPath);
+    }
+
+    return ret;
+}
+
 const SoundFontPaths& SoundFontRepository::soundFontPaths() const
 {
     return m_soundFontPaths;
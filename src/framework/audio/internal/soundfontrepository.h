@@ -22,6 +22,10 @@
 #ifndef MU_AUDIO_SOUNDFONTREPOSITORY_H
 #define MU_AUDIO_SOUNDFONTREPOSITORY_H
 
+#include <atomic>
+#include <map>
+#include <thread>
+
 #include "audio/isoundfontrepository.h"
 
 #include "modularity/ioc.h"
@@ -29,6 +33,9 @@
 #include "audio/iaudioconfiguration.h"
 #include "io/ifilesystem.h"
 #include "async/asyncable.h"
+#include "async/channel.h"
+#include "types/datetime.h"
+#include "types/retval.h"
 
 namespace mu::audio {
 class SoundFontRepository : public ISoundFontRepository, public async::Asyncable
@@ -38,6 +45,8 @@ class SoundFontRepository : public ISoundFontRepository, public async::Asyncable
     INJECT(io::IFileSystem, fileSystem)
 
 public:
+    ~SoundFontRepository() override;
+
     void init();
 
     const synth::SoundFontPaths& soundFontPaths() const override;
@@ -47,14 +56,39 @@ public:
     Ret addSoundFont(const synth::SoundFontPath& path) override;
 
 private:
+    struct IndexEntry {
+        uint64_t fileSize = 0;
+        DateTime lastModified;
+        synth::SoundFontMeta meta;
+    };
+
+    using SoundFontIndex = std::map<synth::SoundFontPath, IndexEntry>;
+
     void loadSoundFonts();
-    void loadSoundFont(const synth::SoundFontPath& path, const synth::SoundFontsMap& oldSoundFonts = {});
+    void loadSoundFont(const synth::SoundFontPath& path);
+
+    IndexEntry indexEntryStamp(const synth::SoundFontPath& path) const;
+
+    void startParsing(const synth::SoundFontPaths& paths);
+    void stopParsing();
+    void onSoundFontParsed(size_t generation, const synth::SoundFontPath& path, const RetVal<synth::SoundFontMeta>& meta);
+
+    void readIndex();
+    Ret writeIndex() const;
 
     RetVal<synth::SoundFontPath> resolveInstallationPath(const synth::SoundFontPath& path) const;
 
     synth::SoundFontPaths m_soundFontPaths;
     synth::SoundFontsMap m_soundFonts;
     async::Notification m_soundFontsChanged;
+
+    SoundFontIndex m_index;
+    SoundFontIndex m_pendingIndexEntries;
+
+    std::thread m_parsingThread;
+    std::atomic<bool> m_abortParsing = false;
+    size_t m_parsingGeneration = 0;
+    async::Channel<size_t, synth::SoundFontPath, RetVal<synth::SoundFontMeta> > m_soundFontParsed;
 };
 }
 
@@ -50,6 +50,13 @@ ISynthesizerPtr FluidResolver::resolveSynth(const TrackId /*trackId*/, const Aud
     auto search = m_resourcesCache.find(params.resourceMeta.id);
     if (search == m_resourcesCache.end()) {
         LOGE() << "Not found: " << params.resourceMeta.id;
+
+        //! NOTE The SoundFonts are parsed in the background, the synth gets its SoundFont when it's parsed (see refresh).
+        //! A pre-rendering synth is created again by its source then
+        if (params.configuration.find(PRE_RENDER_INSTANCE_CONFIG_KEY) == params.configuration.cend()) {
+            m_unresolvedSynths.push_back(synth);
+        }
+
         return synth;
     }
 
@@ -129,6 +136,30 @@ void FluidResolver::refresh()
             m_resourcesCache.emplace(id, SoundFontResource { soundFont.path, preset.program, std::move(meta) });
         }
     }
+
+    resolveLateSynths();
+}
+
+void FluidResolver::resolveLateSynths()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (auto it = m_unresolvedSynths.begin(); it != m_unresolvedSynths.end();) {
+        FluidSynthPtr synth = it->lock();
+        if (!synth) {
+            it = m_unresolvedSynths.erase(it);
+            continue;
+        }
+
+        auto search = m_resourcesCache.find(synth->params().resourceMeta.id);
+        if (search == m_resourcesCache.end()) {
+            ++it;
+            continue;
+        }
+
+        synth->loadLateSoundFont(search->second.path, search->second.preset);
+        it = m_unresolvedSynths.erase(it);
+    }
 }
 
 void FluidResolver::clearSources()
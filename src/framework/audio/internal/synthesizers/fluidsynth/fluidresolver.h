@@ -25,6 +25,7 @@
 
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
@@ -50,6 +51,7 @@ public:
 
 private:
     FluidSynthPtr createSynth(const audio::AudioResourceId& resourceId) const;
+    void resolveLateSynths();
 
     struct SoundFontResource {
         io::path_t path;
@@ -58,6 +60,9 @@ private:
     };
 
     std::unordered_map<AudioResourceId, SoundFontResource> m_resourcesCache;
+
+    //! NOTE The synths whose SoundFont was not parsed yet when they were resolved
+    mutable std::vector<std::weak_ptr<FluidSynth> > m_unresolvedSynths;
 };
 }
 
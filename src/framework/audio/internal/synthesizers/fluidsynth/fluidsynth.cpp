@@ -25,7 +25,11 @@
 #include <thread>
 #include <sstream>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
 #include <fluidsynth.h>
 
 #include "log.h"
@@ -34,6 +38,7 @@
 #include "sfcachedloader.h"
 #include "audioerrors.h"
 #include "audiotypes.h"
+#include "audioutils.h"
 
 using namespace mu;
 using namespace mu::midi;
@@ -45,6 +50,9 @@ static constexpr double FLUID_GLOBAL_VOLUME_GAIN = 4.8;
 static constexpr int DEFAULT_MIDI_VOLUME = 100;
 static constexpr msecs_t MIN_NOTE_LENGTH = 10;
 
+static constexpr size_t MAX_RENDER_SHARDS = 8;
+static constexpr samples_t PREALLOCATED_SHARD_SAMPLES = 4096;
+
 /// @note
 ///  Fluid does not support MONO, so they start counting audio channels from 1, which means "1 pair of audio channels"
 /// @see https://www.fluidsynth.org/api/settings_synth.html
@@ -52,20 +60,155 @@ static constexpr unsigned int FLUID_AUDIO_CHANNELS_PAIR = 1;
 static constexpr unsigned int FLUID_AUDIO_CHANNELS_COUNT = FLUID_AUDIO_CHANNELS_PAIR * 2;
 
 struct mu::audio::synth::Fluid {
+    struct Shard {
+        fluid_synth_t* synth = nullptr;
+        std::vector<float> buffer;
+    };
+
     fluid_settings_t* settings = nullptr;
     fluid_synth_t* synth = nullptr;
 
+    //! NOTE Additional synth instances, each one plays the notes of a part of the MIDI channels
+    //! and renders on its own thread, in parallel with the others.
+    //! All of them receive the same channel setup and controllers, so they sound as one synth.
+    //! A whole channel is played by one instance, so the exclusive classes (e.g. a closing hi-hat
+    //! cutting the open one) and the portamento/legato of the channel keep working.
+    //! So only the tracks that play on several channels gain from the shards,
+    //! a part that plays on a single channel (e.g. a piano) is still rendered by one instance
+    std::vector<Shard> shards;
+
+    template<typename Func>
+    void forEachSynth(Func func)
+    {
+        func(synth);
+        for (Shard& shard : shards) {
+            func(shard.synth);
+        }
+    }
+
+    fluid_synth_t* synthForChannel(const midi::channel_t channel) const
+    {
+        const size_t idx = static_cast<size_t>(channel) % (shards.size() + 1);
+        return idx == 0 ? synth : shards[idx - 1].synth;
+    }
+
+    void startShardThreads()
+    {
+        m_stopThreads = false;
+        for (size_t i = 0; i < shards.size(); ++i) {
+            m_threads.emplace_back([this, i, generation = m_renderGeneration]() {
+                runShard(i, generation);
+            });
+        }
+    }
+
+    void stopShardThreads()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopThreads = true;
+        }
+        m_renderRequested.notify_all();
+
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+        m_threads.clear();
+    }
+
+    //! NOTE Called on the audio thread, nothing is allocated here:
+    //! the shard threads are woken up, the synth of the calling thread renders meanwhile,
+    //! then the calling thread waits for the shards without blocking on a lock
+    bool renderShards(float* buffer, samples_t samplesPerChannel)
+    {
+        m_renderOk = true;
+        m_pendingShards.store(shards.size(), std::memory_order_release);
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_samplesToRender = samplesPerChannel;
+            ++m_renderGeneration;
+        }
+        m_renderRequested.notify_all();
+
+        bool ok = write(synth, buffer, samplesPerChannel);
+
+        while (m_pendingShards.load(std::memory_order_acquire) > 0) {
+            std::this_thread::yield();
+        }
+
+        return ok && m_renderOk;
+    }
+
+    static bool write(fluid_synth_t* synth, float* out, samples_t samplesPerChannel)
+    {
+        return fluid_synth_write_float(synth, samplesPerChannel,
+                                       out, 0, FLUID_AUDIO_CHANNELS_COUNT,
+                                       out, 1, FLUID_AUDIO_CHANNELS_COUNT) == FLUID_OK;
+    }
+
+    void deleteSynths()
+    {
+        stopShardThreads();
+
+        forEachSynth([](fluid_synth_t* s) {
+            delete_fluid_synth(s);
+        });
+
+        synth = nullptr;
+        shards.clear();
+    }
+
     ~Fluid()
     {
-        delete_fluid_synth(synth);
+        deleteSynths();
         delete_fluid_settings(settings);
     }
+
+private:
+    void runShard(size_t idx, uint64_t renderedGeneration)
+    {
+        while (true) {
+            samples_t samplesPerChannel = 0;
+
+            {
+                std::unique_lock lock(m_mutex);
+                m_renderRequested.wait(lock, [this, renderedGeneration]() {
+                    return m_stopThreads || m_renderGeneration != renderedGeneration;
+                });
+
+                if (m_stopThreads) {
+                    return;
+                }
+
+                renderedGeneration = m_renderGeneration;
+                samplesPerChannel = m_samplesToRender;
+            }
+
+            Shard& shard = shards[idx];
+            if (!write(shard.synth, shard.buffer.data(), samplesPerChannel)) {
+                m_renderOk = false;
+            }
+
+            m_pendingShards.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_renderRequested;
+    bool m_stopThreads = false;
+    uint64_t m_renderGeneration = 0;
+    samples_t m_samplesToRender = 0;
+    std::atomic<size_t> m_pendingShards = 0;
+    std::atomic<bool> m_renderOk = true;
 };
 
 FluidSynth::FluidSynth(const AudioSourceParams& params)
     : AbstractSynthesizer(params)
 {
     m_fluid = std::make_shared<Fluid>();
+    m_sendMidiOut = params.configuration.find(PRE_RENDER_INSTANCE_CONFIG_KEY) == params.configuration.cend();
 
     init();
 }
@@ -138,12 +281,40 @@ Ret FluidSynth::init()
 
 void FluidSynth::createFluidInstance()
 {
-    m_fluid->synth = new_fluid_synth(m_fluid->settings);
+    auto createSynth = [this]() {
+        fluid_synth_t* synth = new_fluid_synth(m_fluid->settings);
+
+        fluid_sfloader_t* sfloader = new_fluid_sfloader(loadSoundFont, delete_fluid_sfloader);
+
+        fluid_sfloader_set_data(sfloader, m_fluid->settings);
+        fluid_synth_add_sfloader(synth, sfloader);
+
+        return synth;
+    };
+
+    m_fluid->synth = createSynth();
+
+    for (size_t i = 1; i < renderShardsCount(); ++i) {
+        Fluid::Shard shard;
+        shard.synth = createSynth();
+        shard.buffer.resize(PREALLOCATED_SHARD_SAMPLES * FLUID_AUDIO_CHANNELS_COUNT);
+        m_fluid->shards.push_back(std::move(shard));
+    }
+
+    m_fluid->startShardThreads();
+}
+
+size_t FluidSynth::renderShardsCount() const
+{
+    //! NOTE The pre-render instances already render on their own thread, ahead of the playback
+    if (m_params.configuration.find(PRE_RENDER_INSTANCE_CONFIG_KEY) != m_params.configuration.cend()) {
+        return 1;
+    }
 
-    fluid_sfloader_t* sfloader = new_fluid_sfloader(loadSoundFont, delete_fluid_sfloader);
+    auto it = m_params.configuration.find(FLUID_RENDER_SHARDS_CONFIG_KEY);
+    const int count = it != m_params.configuration.cend() ? std::atoi(it->second.c_str()) : config()->fluidRenderShards();
 
-    fluid_sfloader_set_data(sfloader, m_fluid->settings);
-    fluid_synth_add_sfloader(m_fluid->synth, sfloader);
+    return std::clamp(static_cast<size_t>(std::max(count, 1)), size_t(1), MAX_RENDER_SHARDS);
 }
 
 bool FluidSynth::handleEvent(const midi::Event& event)
@@ -151,11 +322,11 @@ bool FluidSynth::handleEvent(const midi::Event& event)
     int ret = FLUID_OK;
     switch (event.opcode()) {
     case Event::Opcode::NoteOn: {
-        ret = fluid_synth_noteon(m_fluid->synth, event.channel(), event.note(), event.velocity());
+        ret = fluid_synth_noteon(m_fluid->synthForChannel(event.channel()), event.channel(), event.note(), event.velocity());
         m_tuning.add(event.note(), event.pitchTuningCents());
     } break;
     case Event::Opcode::NoteOff: {
-        ret = fluid_synth_noteoff(m_fluid->synth, event.channel(), event.note());
+        ret = fluid_synth_noteoff(m_fluid->synthForChannel(event.channel()), event.channel(), event.note());
         m_tuning.add(event.note(), event.pitchTuningCents());
     } break;
     case Event::Opcode::ControlChange: {
@@ -166,10 +337,14 @@ bool FluidSynth::handleEvent(const midi::Event& event)
         }
     } break;
     case Event::Opcode::ProgramChange: {
-        fluid_synth_program_change(m_fluid->synth, event.channel(), event.program());
+        m_fluid->forEachSynth([&event](fluid_synth_t* synth) {
+            fluid_synth_program_change(synth, event.channel(), event.program());
+        });
     } break;
     case Event::Opcode::PitchBend: {
-        ret = fluid_synth_pitch_bend(m_fluid->synth, event.channel(), event.data());
+        m_fluid->forEachSynth([&event, &ret](fluid_synth_t* synth) {
+            ret = fluid_synth_pitch_bend(synth, event.channel(), event.data());
+        });
     } break;
     default: {
         LOGD() << "not supported event type: " << event.opcodeString();
@@ -177,7 +352,9 @@ bool FluidSynth::handleEvent(const midi::Event& event)
     }
     }
 
-    midiOutPort()->sendEvent(event);
+    if (m_sendMidiOut) {
+        midiOutPort()->sendEvent(event);
+    }
 
     return ret == FLUID_OK;
 }
@@ -193,9 +370,8 @@ void FluidSynth::setSampleRate(unsigned int sampleRate)
         fluid_settings_setnum(m_fluid->settings, "synth.sample-rate", static_cast<double>(m_sampleRate));
     }
 
-    if (m_fluid->synth) {
-        delete_fluid_synth(m_fluid->synth);
-    }
+    m_fluid->deleteSynths();
+    m_renderedSamples = 0;
 
     createFluidInstance();
     addSoundFonts(std::vector<io::path_t>(m_sfontPaths.cbegin(), m_sfontPaths.cend()));
@@ -210,7 +386,14 @@ Ret FluidSynth::addSoundFonts(const std::vector<io::path_t>& sfonts)
 
     bool ok = true;
     for (const io::path_t& sfont : sfonts) {
-        if (fluid_synth_sfload(m_fluid->synth, sfont.c_str(), 0) == FLUID_FAILED) {
+        bool loaded = true;
+
+        //! NOTE The SoundFont data is shared by the synth instances (see SoundFontCache)
+        m_fluid->forEachSynth([&sfont, &loaded](fluid_synth_t* synth) {
+            loaded = loaded && fluid_synth_sfload(synth, sfont.c_str(), 0) != FLUID_FAILED;
+        });
+
+        if (!loaded) {
             LOGE() << "failed load soundfont: " << sfont;
             ok = false;
             continue;
@@ -228,6 +411,19 @@ void FluidSynth::setPreset(const std::optional<midi::Program>& preset)
     m_preset = preset;
 }
 
+void FluidSynth::loadLateSoundFont(const io::path_t& sfont, const std::optional<midi::Program>& preset)
+{
+    if (!addSoundFonts({ sfont })) {
+        return;
+    }
+
+    setPreset(preset);
+    setupSound(m_setupData);
+
+    //! NOTE The params are the same, but the synth sounds differently now
+    m_paramsChanges.send(m_params);
+}
+
 std::string FluidSynth::name() const
 {
     return "Fluid";
@@ -244,18 +440,22 @@ void FluidSynth::setupSound(const PlaybackSetupData& setupData)
         return;
     }
 
-    fluid_synth_activate_key_tuning(m_fluid->synth, 0, 0, "standard", NULL, true);
+    m_fluid->forEachSynth([](fluid_synth_t* synth) {
+        fluid_synth_activate_key_tuning(synth, 0, 0, "standard", NULL, true);
+    });
 
     auto setupChannel = [this](const midi::channel_t channelIdx, const midi::Program& program) {
-        fluid_synth_set_interp_method(m_fluid->synth, channelIdx, FLUID_INTERP_DEFAULT);
-        fluid_synth_pitch_wheel_sens(m_fluid->synth, channelIdx, 24);
-        fluid_synth_bank_select(m_fluid->synth, channelIdx, program.bank);
-        fluid_synth_program_change(m_fluid->synth, channelIdx, program.program);
-        fluid_synth_cc(m_fluid->synth, channelIdx, 7, DEFAULT_MIDI_VOLUME);
-        fluid_synth_cc(m_fluid->synth, channelIdx, 74, 0);
-        fluid_synth_set_portamento_mode(m_fluid->synth, channelIdx, FLUID_CHANNEL_PORTAMENTO_MODE_EACH_NOTE);
-        fluid_synth_set_legato_mode(m_fluid->synth, channelIdx, FLUID_CHANNEL_LEGATO_MODE_RETRIGGER);
-        fluid_synth_activate_tuning(m_fluid->synth, channelIdx, 0, 0, 0);
+        m_fluid->forEachSynth([channelIdx, &program](fluid_synth_t* synth) {
+            fluid_synth_set_interp_method(synth, channelIdx, FLUID_INTERP_DEFAULT);
+            fluid_synth_pitch_wheel_sens(synth, channelIdx, 24);
+            fluid_synth_bank_select(synth, channelIdx, program.bank);
+            fluid_synth_program_change(synth, channelIdx, program.program);
+            fluid_synth_cc(synth, channelIdx, 7, DEFAULT_MIDI_VOLUME);
+            fluid_synth_cc(synth, channelIdx, 74, 0);
+            fluid_synth_set_portamento_mode(synth, channelIdx, FLUID_CHANNEL_PORTAMENTO_MODE_EACH_NOTE);
+            fluid_synth_set_legato_mode(synth, channelIdx, FLUID_CHANNEL_LEGATO_MODE_RETRIGGER);
+            fluid_synth_activate_tuning(synth, channelIdx, 0, 0, 0);
+        });
     };
 
     m_sequencer.channelAdded().onReceive(this, setupChannel);
@@ -280,7 +480,9 @@ void FluidSynth::revokePlayingNotes()
         return;
     }
 
-    fluid_synth_all_notes_off(m_fluid->synth, -1);
+    m_fluid->forEachSynth([](fluid_synth_t* synth) {
+        fluid_synth_all_notes_off(synth, -1);
+    });
 }
 
 void FluidSynth::flushSound()
@@ -291,8 +493,10 @@ void FluidSynth::flushSound()
 
     revokePlayingNotes();
 
-    fluid_synth_all_sounds_off(m_fluid->synth, -1);
-    fluid_synth_cc(m_fluid->synth, -1, 121, 127);
+    m_fluid->forEachSynth([](fluid_synth_t* synth) {
+        fluid_synth_all_sounds_off(synth, -1);
+        fluid_synth_cc(synth, -1, 121, 127);
+    });
 }
 
 bool FluidSynth::isActive() const
@@ -314,6 +518,7 @@ msecs_t FluidSynth::playbackPosition() const
 void FluidSynth::setPlaybackPosition(const msecs_t newPosition)
 {
     m_sequencer.setPlaybackPosition(newPosition);
+    m_renderedSamples = 0;
 
     if (isActive()) {
         setExpressionLevel(m_sequencer.currentExpressionLevel());
@@ -331,28 +536,94 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
-    FluidSequencer::EventSequence sequence = m_sequencer.eventsToBePlayed(nextMsecs);
+    const bool active = isActive();
+    const SynthBlock block = synthBlock(m_renderedSamples, samplesPerChannel, m_sampleRate);
+    const msecs_t nextMsecs = active ? block.durationMsecs : samplesToMsecs(samplesPerChannel, m_sampleRate);
+
+    FluidSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayed(nextMsecs);
+
+    samples_t renderedSamples = 0;
+
+    for (const auto& pair : sequences) {
+        samples_t offset = 0;
+
+        if (active) {
+            offset = std::min(synthEventOffset(block, pair.first), samplesPerChannel);
+        }
+
+        //! NOTE The synth renders up to the events, then they take effect
+        if (offset > renderedSamples) {
+            if (!renderSamples(buffer + renderedSamples * FLUID_AUDIO_CHANNELS_COUNT, offset - renderedSamples)) {
+                return 0;
+            }
+
+            renderedSamples = offset;
+        }
+
+        handleEvents(pair.second);
+    }
+
+    if (renderedSamples < samplesPerChannel) {
+        if (!renderSamples(buffer + renderedSamples * FLUID_AUDIO_CHANNELS_COUNT, samplesPerChannel - renderedSamples)) {
+            return 0;
+        }
+    }
+
+    if (active) {
+        m_renderedSamples += samplesPerChannel;
+    }
+
+    return samplesPerChannel;
+}
 
-    if (!sequence.empty()) {
-        m_tuning.reset();
+void FluidSynth::handleEvents(const FluidSequencer::EventSequence& sequence)
+{
+    if (sequence.empty()) {
+        return;
     }
 
+    m_tuning.reset();
+
     for (const FluidSequencer::EventType& event : sequence) {
         handleEvent(std::get<midi::Event>(event));
     }
 
-    fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    m_fluid->forEachSynth([this](fluid_synth_t* synth) {
+        fluid_synth_tune_notes(synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    });
+}
 
-    int result = fluid_synth_write_float(m_fluid->synth, samplesPerChannel,
-                                         buffer, 0, FLUID_AUDIO_CHANNELS_COUNT,
-                                         buffer, 1, FLUID_AUDIO_CHANNELS_COUNT);
+bool FluidSynth::renderSamples(float* buffer, samples_t samplesPerChannel)
+{
+    if (!m_fluid->shards.empty()) {
+        return processShards(buffer, samplesPerChannel);
+    }
 
-    if (result != FLUID_OK) {
-        return 0;
+    return Fluid::write(m_fluid->synth, buffer, samplesPerChannel);
+}
+
+bool FluidSynth::processShards(float* buffer, samples_t samplesPerChannel)
+{
+    const size_t bufferSize = samplesPerChannel * FLUID_AUDIO_CHANNELS_COUNT;
+
+    for (Fluid::Shard& shard : m_fluid->shards) {
+        //! NOTE Preallocated for the usual block sizes, grows only for a larger one
+        if (shard.buffer.size() < bufferSize) {
+            shard.buffer.resize(bufferSize);
+        }
     }
 
-    return samplesPerChannel;
+    if (!m_fluid->renderShards(buffer, samplesPerChannel)) {
+        return false;
+    }
+
+    for (const Fluid::Shard& shard : m_fluid->shards) {
+        for (size_t i = 0; i < bufferSize; ++i) {
+            buffer[i] += shard.buffer[i];
+        }
+    }
+
+    return true;
 }
 
 async::Channel<unsigned int> FluidSynth::audioChannelsCountChanged() const
@@ -376,7 +647,9 @@ int FluidSynth::setExpressionLevel(int level)
     midi::channel_t lastChannelIdx = m_sequencer.channels().lastIndex();
 
     for (midi::channel_t i = 0; i < lastChannelIdx; ++i) {
-        fluid_synth_cc(m_fluid->synth, i, midi::EXPRESSION_CONTROLLER, level);
+        m_fluid->forEachSynth([i, level](fluid_synth_t* synth) {
+            fluid_synth_cc(synth, i, midi::EXPRESSION_CONTROLLER, level);
+        });
     }
 
     return FLUID_OK;
@@ -391,5 +664,12 @@ int FluidSynth::setControllerValue(const midi::Event& event)
         return FLUID_OK;
     }
 
-    return fluid_synth_cc(m_fluid->synth, event.channel(), event.index(),  event.data());
+    int ret = FLUID_OK;
+    m_fluid->forEachSynth([&event, &ret](fluid_synth_t* synth) {
+        if (fluid_synth_cc(synth, event.channel(), event.index(), event.data()) != FLUID_OK) {
+            ret = FLUID_FAILED;
+        }
+    });
+
+    return ret;
 }
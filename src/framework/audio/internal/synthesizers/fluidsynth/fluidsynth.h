@@ -49,6 +49,9 @@ public:
     Ret addSoundFonts(const std::vector<io::path_t>& sfonts);
     void setPreset(const std::optional<midi::Program>& preset);
 
+    //! NOTE Loads the SoundFont of a synth that was created before its SoundFont was known
+    void loadLateSoundFont(const io::path_t& sfont, const std::optional<midi::Program>& preset);
+
     std::string name() const override;
     AudioSourceType type() const override;
     void setupSound(const mpe::PlaybackSetupData& setupData) override;
@@ -100,7 +103,12 @@ private:
 
     Ret init();
     void createFluidInstance();
+    size_t renderShardsCount() const;
+
+    bool processShards(float* buffer, samples_t samplesPerChannel);
+    bool renderSamples(float* buffer, samples_t samplesPerChannel);
 
+    void handleEvents(const FluidSequencer::EventSequence& sequence);
     bool handleEvent(const midi::Event& event);
 
     void toggleExpressionController();
@@ -113,10 +121,13 @@ private:
     async::Channel<unsigned int> m_streamsCountChanged;
 
     FluidSequencer m_sequencer;
+    samples_t m_renderedSamples = 0; // since the last position change
     std::set<io::path_t> m_sfontPaths;
     std::optional<midi::Program> m_preset;
 
     KeyTuning m_tuning;
+
+    bool m_sendMidiOut = true;
 };
 
 using FluidSynthPtr = std::shared_ptr<FluidSynth>;
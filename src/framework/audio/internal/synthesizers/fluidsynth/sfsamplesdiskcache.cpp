@@ -0,0 +1,252 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "sfsamplesdiskcache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sys/stat.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <sfloader/fluid_samplecache.h>
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "concurrency/taskscheduler.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::audio::synth;
+
+static constexpr uint32_t CACHE_FILE_MAGIC = 0x4353534D; // "MSSC"
+static constexpr uint32_t CACHE_FILE_VERSION = 1;
+
+//! NOTE The cache files are written on their own thread, not on the shared task scheduler:
+//! the mixer waits on it for the tracks of every block, a file being written there would delay the block
+static TaskScheduler* cacheWriteScheduler()
+{
+    static TaskScheduler scheduler(1);
+    return &scheduler;
+}
+
+struct CacheFileHeader {
+    uint32_t magic = CACHE_FILE_MAGIC;
+    uint32_t version = CACHE_FILE_VERSION;
+    uint32_t sampleCount = 0;
+    uint32_t reserved = 0;
+};
+
+//! NOTE Holds the path of the SoundFont the samples of the directory are decoded from
+static const std::string SOURCE_FILE_NAME("source");
+
+static path_t s_cacheDir;
+
+//! NOTE Identifies this process in the names of the temporary files, the cache may be shared by several processes
+static uint64_t s_processId = 0;
+static std::atomic<uint64_t> s_tempFileCounter = 0;
+
+static uint64_t fnv1a(const std::string& str)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : str) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static bool fileModificationTime(const std::string& path, time_t& mtime)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+
+    mtime = st.st_mtime;
+    return true;
+}
+
+void SoundFontSamplesDiskCache::init(const io::path_t& cacheDir)
+{
+    Ret ret = fileSystem()->makePath(cacheDir);
+    if (!ret) {
+        LOGW() << "Unable to create the SoundFont samples cache directory: " << cacheDir << ", err: " << ret.toString();
+        return;
+    }
+
+    s_cacheDir = cacheDir;
+    s_processId = std::random_device()();
+    s_processId = (s_processId << 32) | std::random_device()();
+
+    removeStaleSoundFonts();
+
+    fluid_samplecache_set_persistent_funcs(loadSamples, storeSamples);
+}
+
+void SoundFontSamplesDiskCache::removeStaleSoundFonts()
+{
+    TRACEFUNC;
+
+    RetVal<paths_t> entries = fileSystem()->scanFiles(s_cacheDir, { "*" }, ScanMode::FilesAndFoldersInCurrentDir);
+    if (!entries.ret) {
+        LOGW() << entries.ret.toString();
+        return;
+    }
+
+    for (const path_t& dir : entries.val) {
+        if (fileSystem()->entryType(dir) != EntryType::Dir) {
+            continue;
+        }
+
+        RetVal<ByteArray> source = fileSystem()->readFile(dir.toStdString() + "/" + SOURCE_FILE_NAME);
+        const std::string soundFontPath = source.ret
+                                          ? std::string(reinterpret_cast<const char*>(source.val.constData()), source.val.size())
+                                          : std::string();
+
+        time_t mtime = 0;
+        const bool isActual = !soundFontPath.empty()
+                              && fileModificationTime(soundFontPath, mtime)
+                              && io::filename(soundFontDirPath(soundFontPath, mtime)) == io::filename(dir);
+
+        if (!isActual) {
+            LOGI() << "Removing the stale SoundFont samples cache: " << dir;
+            fileSystem()->remove(dir);
+        }
+    }
+}
+
+int SoundFontSamplesDiskCache::loadSamples(const char* filename, time_t mtime, unsigned int sampleStart, unsigned int sampleEnd,
+                                           short** data)
+{
+    const path_t filePath = samplesFilePath(filename, mtime, sampleStart, sampleEnd);
+    if (!fileSystem()->exists(filePath)) {
+        return -1;
+    }
+
+    RetVal<ByteArray> content = fileSystem()->readFile(filePath);
+    if (!content.ret || content.val.size() < sizeof(CacheFileHeader)) {
+        return -1;
+    }
+
+    CacheFileHeader header;
+    std::memcpy(&header, content.val.constData(), sizeof(CacheFileHeader));
+
+    const size_t dataSize = static_cast<size_t>(header.sampleCount) * sizeof(short);
+    if (header.magic != CACHE_FILE_MAGIC || header.version != CACHE_FILE_VERSION
+        || content.val.size() != sizeof(CacheFileHeader) + dataSize) {
+        LOGW() << "Ignoring an invalid SoundFont samples cache file: " << filePath;
+        return -1;
+    }
+
+    //! NOTE The data is released by FluidSynth, so it must be allocated by FluidSynth's allocator
+    *data = static_cast<short*>(fluid_alloc(std::max<size_t>(dataSize, sizeof(short))));
+    if (!*data) {
+        return -1;
+    }
+
+    std::memcpy(*data, content.val.constData() + sizeof(CacheFileHeader), dataSize);
+
+    return static_cast<int>(header.sampleCount);
+}
+
+void SoundFontSamplesDiskCache::storeSamples(const char* filename, time_t mtime, unsigned int sampleStart, unsigned int sampleEnd,
+                                             const short* data, int sampleCount)
+{
+    if (!data || sampleCount <= 0) {
+        return;
+    }
+
+    CacheFileHeader header;
+    header.sampleCount = static_cast<uint32_t>(sampleCount);
+
+    const size_t dataSize = static_cast<size_t>(sampleCount) * sizeof(short);
+    ByteArray content(sizeof(CacheFileHeader) + dataSize);
+    std::memcpy(content.data(), &header, sizeof(CacheFileHeader));
+    std::memcpy(content.data() + sizeof(CacheFileHeader), data, dataSize);
+
+    const path_t dirPath = soundFontDirPath(filename, mtime);
+    const path_t sourceFilePath = dirPath.toStdString() + "/" + SOURCE_FILE_NAME;
+    const std::string soundFontPath(filename);
+
+    //! NOTE Several processes may share the cache, so the files are written aside and then moved in place,
+    //! a reader never sees a partially written file
+    const path_t filePath = samplesFilePath(filename, mtime, sampleStart, sampleEnd);
+    const std::string tempSuffix = "." + std::to_string(s_processId) + "-" + std::to_string(++s_tempFileCounter) + ".tmp";
+
+    //! NOTE Called while a sample is being loaded, possibly by the audio thread, so the file is written in the background
+    auto fs = fileSystem();
+    cacheWriteScheduler()->push([fs, dirPath, sourceFilePath, soundFontPath, filePath, tempSuffix, content]() {
+        auto writeAside = [&fs, &tempSuffix](const path_t& path, const ByteArray& data) {
+            const path_t tempPath = path.toStdString() + tempSuffix;
+
+            Ret ret = fs->writeFile(tempPath, data);
+            if (ret) {
+                ret = fs->move(tempPath, path, true);
+            }
+
+            if (!ret) {
+                fs->remove(tempPath);
+            }
+
+            return ret;
+        };
+
+        Ret ret = fs->makePath(dirPath);
+        if (ret && !fs->exists(sourceFilePath)) {
+            ret = writeAside(sourceFilePath, ByteArray(soundFontPath.c_str()));
+        }
+
+        if (ret) {
+            ret = writeAside(filePath, content);
+        }
+
+        if (!ret) {
+            LOGW() << "Unable to store decoded SoundFont samples: " << filePath << ", err: " << ret.toString();
+        }
+    });
+}
+
+io::path_t SoundFontSamplesDiskCache::soundFontDirPath(const std::string& filename, time_t mtime)
+{
+    const std::string soundFontKey = filename + "|" + std::to_string(static_cast<long long>(mtime));
+
+    char dirName[17];
+    std::snprintf(dirName, sizeof(dirName), "%016llx", static_cast<unsigned long long>(fnv1a(soundFontKey)));
+
+    return s_cacheDir.toStdString() + "/" + dirName;
+}
+
+io::path_t SoundFontSamplesDiskCache::samplesFilePath(const char* filename, time_t mtime, unsigned int sampleStart,
+                                                      unsigned int sampleEnd)
+{
+    return soundFontDirPath(filename, mtime).toStdString() + "/" + std::to_string(sampleStart) + "-" + std::to_string(sampleEnd) + ".pcm";
+}
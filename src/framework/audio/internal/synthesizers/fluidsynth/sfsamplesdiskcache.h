@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_SFSAMPLESDISKCACHE_H
+#define MU_AUDIO_SFSAMPLESDISKCACHE_H
+
+#include <ctime>
+
+#include "modularity/ioc.h"
+#include "io/ifilesystem.h"
+
+namespace mu::audio::synth {
+//! NOTE Decoding the Ogg Vorbis samples of an SF3 SoundFont takes most of its loading time,
+//! so the decoded samples are stored on disk and read back by the next synth instances and sessions.
+//! Samples are still decoded only when a preset using them is selected (dynamic sample loading).
+//! The directories of the SoundFonts that were removed or changed since they were cached are removed on init.
+class SoundFontSamplesDiskCache
+{
+    INJECT_STATIC(io::IFileSystem, fileSystem)
+public:
+    static void init(const io::path_t& cacheDir);
+
+private:
+    static int loadSamples(const char* filename, time_t mtime, unsigned int sampleStart, unsigned int sampleEnd, short** data);
+    static void storeSamples(const char* filename, time_t mtime, unsigned int sampleStart, unsigned int sampleEnd,
+                             const short* data, int sampleCount);
+
+    static void removeStaleSoundFonts();
+
+    static io::path_t soundFontDirPath(const std::string& filename, time_t mtime);
+    static io::path_t samplesFilePath(const char* filename, time_t mtime, unsigned int sampleStart, unsigned int sampleEnd);
+};
+}
+
+#endif // MU_AUDIO_SFSAMPLESDISKCACHE_H
@@ -149,9 +149,9 @@ Promise<AudioResourceMetaList> AudioOutputHandler::availableOutputResources() co
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const
+Promise<AudioSignalsMeterPtr> AudioOutputHandler::signalsMeter(const TrackSequenceId sequenceId, const TrackId trackId) const
 {
-    return Promise<AudioSignalChanges>([this, sequenceId, trackId](auto resolve, auto reject) {
+    return Promise<AudioSignalsMeterPtr>([this, sequenceId, trackId](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         ITrackSequencePtr s = sequence(sequenceId);
@@ -164,20 +164,20 @@ Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenc
             return reject(static_cast<int>(Err::InvalidTrackId), "no track");
         }
 
-        return resolve(s->audioIO()->audioSignalChanges(trackId));
+        return resolve(s->audioIO()->audioSignalsMeter(trackId));
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
+Promise<AudioSignalsMeterPtr> AudioOutputHandler::masterSignalsMeter() const
 {
-    return Promise<AudioSignalChanges>([this](auto resolve, auto reject) {
+    return Promise<AudioSignalsMeterPtr>([this](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
             return reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
         }
 
-        return resolve(mixer()->masterAudioSignalChanges());
+        return resolve(mixer()->masterAudioSignalsMeter());
     }, AudioThread::ID);
 }
 
@@ -22,6 +22,8 @@
 
 #include "eventaudiosource.h"
 
+#include <optional>
+
 #include "log.h"
 
 #include "internal/audiosanitizer.h"
@@ -31,23 +33,35 @@ using namespace mu::audio;
 using namespace mu::audio::synth;
 using namespace mu::mpe;
 
+//! NOTE Notes may still sound after their end
+static constexpr msecs_t RELEASE_MARGIN = 2000000;
+
 EventAudioSource::EventAudioSource(const TrackId trackId, const mpe::PlaybackData& playbackData)
     : m_trackId(trackId), m_playbackData(playbackData)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
     m_playbackData.mainStream.onReceive(this, [this](const PlaybackEventsMap& events) {
-        m_playbackData.originEvents = events;
+        onMainStreamReceived(events);
     });
 
     m_playbackData.dynamicLevelChanges.onReceive(this, [this](const DynamicLevelMap& changes) {
         m_playbackData.dynamicLevelMap = changes;
+
+        if (m_preRenderCache) {
+            m_preRenderCache->setPlaybackData(m_playbackData);
+            m_preRenderCache->invalidateAll();
+        }
     });
 }
 
 EventAudioSource::~EventAudioSource()
 {
     m_playbackData.mainStream.resetOnReceive(this);
+
+    if (m_preRenderCache) {
+        m_preRenderCache->stop();
+    }
 }
 
 bool EventAudioSource::isActive() const
@@ -77,6 +91,10 @@ void EventAudioSource::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    if (m_sampleRate == sampleRate) {
+        return;
+    }
+
     m_sampleRate = sampleRate;
 
     if (!m_synth) {
@@ -84,6 +102,7 @@ void EventAudioSource::setSampleRate(unsigned int sampleRate)
     }
 
     m_synth->setSampleRate(sampleRate);
+    setupPreRenderCache();
 }
 
 unsigned int EventAudioSource::audioChannelsCount() const
@@ -116,6 +135,24 @@ samples_t EventAudioSource::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
+    if (m_preRenderCache && m_synth->isActive()) {
+        const samples_t frame = m_positionFrames;
+        m_positionFrames += samplesPerChannel;
+        m_preRenderCache->renderAhead(m_positionFrames);
+
+        if (m_preRenderCache->read(frame, buffer, samplesPerChannel)) {
+            m_synthOutOfSync = true;
+            return samplesPerChannel;
+        }
+
+        //! NOTE The cache misses, e.g. right after an edit: the synth continues from the current position
+        if (m_synthOutOfSync) {
+            m_synth->setPlaybackPosition(static_cast<msecs_t>(frame * 1000000.0 / m_sampleRate));
+            m_synth->revokePlayingNotes();
+            m_synthOutOfSync = false;
+        }
+    }
+
     return m_synth->process(buffer, samplesPerChannel);
 }
 
@@ -129,6 +166,9 @@ void EventAudioSource::seek(const msecs_t newPositionMsecs)
 
     m_synth->setPlaybackPosition(newPositionMsecs);
     m_synth->revokePlayingNotes();
+
+    m_positionFrames = static_cast<samples_t>(newPositionMsecs * static_cast<double>(m_sampleRate) / 1000000.0);
+    m_synthOutOfSync = false;
 }
 
 const AudioInputParams& EventAudioSource::inputParams() const
@@ -151,6 +191,9 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
     }
 
     m_synth->paramsChanged().onReceive(this, [this](const AudioInputParams& params) {
+        //! NOTE The synth sounds differently, so the pre-rendered audio is stale
+        setupPreRenderCache();
+
         m_paramsChanges.send(params);
     });
 
@@ -164,6 +207,8 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
 
     m_params = m_synth->params();
     m_paramsChanges.send(m_params);
+
+    setupPreRenderCache();
 }
 
 async::Channel<AudioInputParams> EventAudioSource::inputParamsChanged() const
@@ -197,3 +242,54 @@ void EventAudioSource::setupSource()
     m_synth->setSampleRate(m_sampleRate);
     m_synth->setup(m_playbackData);
 }
+
+void EventAudioSource::setupPreRenderCache()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_preRenderCache) {
+        m_preRenderCache->stop();
+        m_preRenderCache = nullptr;
+    }
+
+    //! NOTE Only Fluid synths are pre-rendered: the other synths are either not deterministic
+    //! or can't have another instance of the same plugin running on a background thread
+    if (!m_synth || m_synth->type() != AudioSourceType::Fluid || m_sampleRate == 0) {
+        return;
+    }
+
+    if (!configuration()->isPreRenderEnabled()) {
+        return;
+    }
+
+    AudioInputParams params = m_synth->params();
+    params.configuration[PRE_RENDER_INSTANCE_CONFIG_KEY] = "1";
+
+    ISynthesizerPtr synth = synthResolver()->resolveSynth(m_trackId, params, m_playbackData.setupData);
+    if (!synth || synth->type() != AudioSourceType::Fluid) {
+        LOGW() << "unable to create the pre-rendering synth for trackId: " << m_trackId;
+        return;
+    }
+
+    m_preRenderCache = std::make_shared<PreRenderCache>(synth, m_playbackData, static_cast<unsigned int>(m_sampleRate),
+                                                        m_synth->audioChannelsCount(), configuration()->renderStep());
+    m_synthOutOfSync = false;
+}
+
+void EventAudioSource::onMainStreamReceived(const mpe::PlaybackEventsMap& events)
+{
+    if (!m_preRenderCache) {
+        m_playbackData.originEvents = events;
+        return;
+    }
+
+    std::optional<std::pair<msecs_t, msecs_t> > range = PreRenderCache::changedRange(m_playbackData.originEvents, events);
+    m_playbackData.originEvents = events;
+
+    if (!range) {
+        return;
+    }
+
+    m_preRenderCache->setPlaybackData(m_playbackData);
+    m_preRenderCache->invalidate(range->first, range->second + RELEASE_MARGIN);
+}
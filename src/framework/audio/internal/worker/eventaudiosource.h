@@ -28,13 +28,16 @@
 #include "mpe/events.h"
 
 #include "audiotypes.h"
+#include "iaudioconfiguration.h"
 #include "isynthresolver.h"
 #include "track.h"
+#include "prerendercache.h"
 
 namespace mu::audio {
 class EventAudioSource : public ITrackAudioInput, public async::Asyncable
 {
     INJECT(synth::ISynthResolver, synthResolver)
+    INJECT(IAudioConfiguration, configuration)
 
 public:
     explicit EventAudioSource(const TrackId trackId, const mpe::PlaybackData& playbackData);
@@ -68,6 +71,8 @@ private:
     };
 
     void setupSource();
+    void setupPreRenderCache();
+    void onMainStreamReceived(const mpe::PlaybackEventsMap& events);
     SynthCtx currentSynthCtx() const;
     void restoreSynthCtx(SynthCtx&& ctx);
 
@@ -77,6 +82,10 @@ private:
     AudioInputParams m_params;
     async::Channel<AudioInputParams> m_paramsChanges;
 
+    PreRenderCachePtr m_preRenderCache = nullptr;
+    samples_t m_positionFrames = 0;
+    bool m_synthOutOfSync = false;
+
     samples_t m_sampleRate = 0;
 };
 }
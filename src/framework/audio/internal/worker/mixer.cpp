@@ -179,8 +179,10 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     }
 
     if (m_masterParams.muted || masterChannelSampleCount == 0 || m_isSilence) {
-        for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0);
+        if (m_audioSignalsMeter->isObserved()) {
+            for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+                notifyAboutAudioSignalChanges(audioChNum, 0);
+            }
         }
         return 0;
     }
@@ -322,9 +324,9 @@ Channel<AudioOutputParams> Mixer::masterOutputParamsChanged() const
     return m_masterOutputParamsChanged;
 }
 
-async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() const
+AudioSignalsMeterPtr Mixer::masterAudioSignalsMeter() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalsMeter;
 }
 
 void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount, bool& outBufferIsSilent)
@@ -427,6 +429,7 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
 
     float totalSquaredSum = 0.f;
     float volume = dsp::linearFromDecibels(m_masterParams.volume);
+    const bool measureSignal = m_audioSignalsMeter->isObserved();
 
     for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
         float singleChannelSquaredSum = 0.f;
@@ -448,8 +451,10 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
             singleChannelSquaredSum += squaredSample;
         }
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+        if (measureSignal) {
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+            notifyAboutAudioSignalChanges(audioChNum, rms);
+        }
     }
 
     if (!m_limiter->isActive()) {
@@ -462,5 +467,5 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
 
 void Mixer::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    m_audioSignalsMeter->updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
 }
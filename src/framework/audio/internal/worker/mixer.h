@@ -61,7 +61,7 @@ public:
     void clearMasterOutputParams();
     async::Channel<AudioOutputParams> masterOutputParamsChanged() const;
 
-    async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
+    AudioSignalsMeterPtr masterAudioSignalsMeter() const;
 
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
@@ -101,7 +101,7 @@ private:
     std::set<IClockPtr> m_clocks;
     audioch_t m_audioChannelsCount = 0;
 
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    AudioSignalsMeterPtr m_audioSignalsMeter = std::make_shared<AudioSignalsMeter>();
 
     bool m_isSilence = false;
 };
@@ -115,9 +115,9 @@ async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
     return m_paramsChanges;
 }
 
-async::Channel<audioch_t, AudioSignalVal> MixerChannel::audioSignalChanges() const
+AudioSignalsMeterPtr MixerChannel::audioSignalsMeter() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalsMeter;
 }
 
 bool MixerChannel::isActive() const
@@ -177,8 +177,10 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         unsigned int channelsCount = audioChannelsCount();
         std::fill(buffer, buffer + samplesPerChannel * channelsCount, 0.f);
 
-        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0.f);
+        if (m_audioSignalsMeter->isObserved()) {
+            for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+                notifyAboutAudioSignalChanges(audioChNum, 0.f);
+            }
         }
 
         return processedSamplesCount;
@@ -202,6 +204,10 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) cons
     float volume = dsp::linearFromDecibels(m_params.volume);
     float totalSquaredSum = 0.f;
 
+    //! NOTE The signal is measured only for the meters on the screen and for the compressor
+    const bool measureSignal = m_audioSignalsMeter->isObserved();
+    const bool measureTotal = measureSignal || m_compressor->isActive();
+
     for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
         float singleChannelSquaredSum = 0.f;
 
@@ -213,14 +219,17 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) cons
             float resultSample = buffer[idx] * totalGain;
             buffer[idx] = resultSample;
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
+            if (measureTotal) {
+                float squaredSample = resultSample * resultSample;
+                singleChannelSquaredSum += squaredSample;
+                totalSquaredSum += squaredSample;
+            }
         }
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
-
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+        if (measureSignal) {
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+            notifyAboutAudioSignalChanges(audioChNum, rms);
+        }
     }
 
     if (!m_compressor->isActive()) {
@@ -233,5 +242,5 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) cons
 
 void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    m_audioSignalsMeter->updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
 }
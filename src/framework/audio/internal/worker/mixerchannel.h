@@ -46,7 +46,7 @@ public:
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
 
-    async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const override;
+    AudioSignalsMeterPtr audioSignalsMeter() const override;
 
     bool isActive() const override;
     void setIsActive(bool arg) override;
@@ -72,7 +72,7 @@ private:
     dsp::CompressorPtr m_compressor = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    AudioSignalsMeterPtr m_audioSignalsMeter = std::make_shared<AudioSignalsMeter>();
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
@@ -102,6 +102,10 @@ void Playback::removeSequence(const TrackSequenceId id)
     Async::call(this, [this, id]() {
         ONLY_AUDIO_WORKER_THREAD;
 
+        //! NOTE The player commands are queued apart from the async calls,
+        //! the ones sent before the removal are run while the sequence still exists
+        processCommands();
+
         auto search = m_sequences.find(id);
 
         if (search != m_sequences.end()) {
@@ -126,6 +130,15 @@ Channel<TrackSequenceId> Playback::sequenceRemoved() const
     return m_sequenceRemoved;
 }
 
+void Playback::processCommands()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_playerHandlersPtr) {
+        m_playerHandlersPtr->processCommands();
+    }
+}
+
 IPlayerPtr Playback::player() const
 {
     ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
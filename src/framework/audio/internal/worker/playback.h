@@ -33,6 +33,7 @@
 #include "iplayback.h"
 
 namespace mu::audio {
+class PlayerHandler;
 class Playback : public IPlayback, public IGetTrackSequence, public async::Asyncable
 {
 public:
@@ -52,12 +53,14 @@ public:
     ITracksPtr tracks() const override;
     IAudioOutputPtr audioOutput() const override;
 
+    void processCommands();
+
 protected:
     // IGetTrackSequence
     ITrackSequencePtr sequence(const TrackSequenceId id) const override;
 
 private:
-    IPlayerPtr m_playerHandlersPtr = nullptr;
+    std::shared_ptr<PlayerHandler> m_playerHandlersPtr = nullptr;
     ITracksPtr m_trackHandlersPtr = nullptr;
     IAudioOutputPtr m_audioOutputPtr = nullptr;
 
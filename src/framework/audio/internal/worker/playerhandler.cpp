@@ -22,8 +22,10 @@
 
 #include "playerhandler.h"
 
+#include <memory>
+#include <thread>
+
 #include "log.h"
-#include "async/async.h"
 
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
@@ -39,112 +41,56 @@ PlayerHandler::PlayerHandler(IGetTrackSequence* getSequence)
 
 PlayerHandler::~PlayerHandler()
 {
+    //! NOTE The commands that were never run still own their loop results
+    Command command;
+    while (m_commands.pop(command)) {
+        delete command.loopResult;
+    }
+
     m_getSequence = nullptr;
 }
 
 void PlayerHandler::play(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->play();
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::Play, sequenceId });
 }
 
 void PlayerHandler::seek(const TrackSequenceId sequenceId, const msecs_t newPositionMsecs)
 {
-    Async::call(this, [this, sequenceId, newPositionMsecs]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->seek(newPositionMsecs);
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::Seek, sequenceId, newPositionMsecs });
 }
 
 void PlayerHandler::stop(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->stop();
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::Stop, sequenceId });
 }
 
 void PlayerHandler::pause(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->pause();
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::Pause, sequenceId });
 }
 
 void PlayerHandler::resume(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->resume();
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::Resume, sequenceId });
 }
 
 void PlayerHandler::setDuration(const TrackSequenceId sequenceId, const msecs_t durationMsec)
 {
-    Async::call(this, [this, sequenceId, durationMsec]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->setDuration(durationMsec);
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::SetDuration, sequenceId, durationMsec });
 }
 
 Promise<bool> PlayerHandler::setLoop(const TrackSequenceId sequenceId, const msecs_t fromMsec, const msecs_t toMsec)
 {
     return Promise<bool>([this, sequenceId, fromMsec, toMsec](auto resolve, auto reject) {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-
-        if (!s) {
-            return reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
-        }
-
-        Ret result = s->player()->setLoop(fromMsec, toMsec);
-
-        if (!result) {
-            return reject(result.code(), result.text());
-        }
-
-        return resolve(result);
-    }, AudioThread::ID);
+        sendCommand({ Command::Type::SetLoop, sequenceId, fromMsec, toMsec, new LoopResult { resolve, reject } });
+        return Promise<bool>::Result::unchecked();
+    }, Promise<bool>::AsynchronyType::ProvidedByBody);
 }
 
 void PlayerHandler::resetLoop(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
-
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->resetLoop();
-        }
-    }, AudioThread::ID);
+    sendCommand({ Command::Type::ResetLoop, sequenceId });
 }
 
 Channel<TrackSequenceId, msecs_t> PlayerHandler::playbackPositionMsecs() const
@@ -161,6 +107,86 @@ Channel<TrackSequenceId, PlaybackStatus> PlayerHandler::playbackStatusChanged()
     return m_playbackStatusChanged;
 }
 
+void PlayerHandler::processCommands()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    Command command;
+    while (m_commands.pop(command)) {
+        executeCommand(command);
+    }
+}
+
+void PlayerHandler::sendCommand(const Command& command)
+{
+    //! NOTE The worker runs the commands sent before this one first, so the order is kept
+    if (AudioSanitizer::isWorkerThread()) {
+        processCommands();
+        executeCommand(command);
+        return;
+    }
+
+    //! NOTE The queue has a single producer: the main thread
+    ONLY_AUDIO_MAIN_THREAD;
+
+    //! NOTE The worker drains the queue on every loop iteration, so it is full only for a moment.
+    //! The command waits for a free slot rather than taking another way, which would reorder it
+    while (!m_commands.push(command)) {
+        std::this_thread::yield();
+    }
+}
+
+void PlayerHandler::executeCommand(const Command& command)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    std::unique_ptr<LoopResult> loopResult(command.loopResult);
+
+    ITrackSequencePtr s = sequence(command.sequenceId);
+    if (!s) {
+        if (loopResult) {
+            (void)loopResult->reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+        }
+        return;
+    }
+
+    switch (command.type) {
+    case Command::Type::Play:
+        s->player()->play();
+        break;
+    case Command::Type::Seek:
+        s->player()->seek(command.msecs);
+        break;
+    case Command::Type::Stop:
+        s->player()->stop();
+        break;
+    case Command::Type::Pause:
+        s->player()->pause();
+        break;
+    case Command::Type::Resume:
+        s->player()->resume();
+        break;
+    case Command::Type::SetDuration:
+        s->player()->setDuration(command.msecs);
+        break;
+    case Command::Type::SetLoop: {
+        Ret result = s->player()->setLoop(command.msecs, command.toMsecs);
+        IF_ASSERT_FAILED(loopResult) {
+            break;
+        }
+
+        if (result) {
+            (void)loopResult->resolve(result);
+        } else {
+            (void)loopResult->reject(result.code(), result.text());
+        }
+    } break;
+    case Command::Type::ResetLoop:
+        s->player()->resetLoop();
+        break;
+    }
+}
+
 ITrackSequencePtr PlayerHandler::sequence(const TrackSequenceId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
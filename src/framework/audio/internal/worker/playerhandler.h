@@ -24,6 +24,7 @@
 #define MU_AUDIO_PLAYERSHANDLER_H
 
 #include "async/asyncable.h"
+#include "concurrency/spscqueue.h"
 
 #include "iplayer.h"
 #include "igettracksequence.h"
@@ -48,12 +49,44 @@ public:
     async::Channel<TrackSequenceId, msecs_t> playbackPositionMsecs() const override;
     async::Channel<TrackSequenceId, PlaybackStatus> playbackStatusChanged() const override;
 
+    void processCommands();
+
 private:
+    struct LoopResult {
+        async::Promise<bool>::Resolve resolve;
+        async::Promise<bool>::Reject reject;
+    };
+
+    struct Command {
+        enum class Type {
+            Play,
+            Seek,
+            Stop,
+            Pause,
+            Resume,
+            SetDuration,
+            SetLoop,
+            ResetLoop
+        };
+
+        Type type = Type::Play;
+        TrackSequenceId sequenceId = -1;
+        msecs_t msecs = 0; // the position, the duration or the loop start
+        msecs_t toMsecs = 0; // the loop end
+        LoopResult* loopResult = nullptr; // SetLoop only, deleted by the worker once the promise is settled
+    };
+
+    void sendCommand(const Command& command);
+    void executeCommand(const Command& command);
+
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
     void ensureSubscriptions(const ITrackSequencePtr s) const;
 
     IGetTrackSequence* m_getSequence = nullptr;
 
+    //! NOTE All the commands of the main thread, in the order they are sent, drained by the worker on every loop iteration
+    SpscQueue<Command, 256> m_commands;
+
     mutable async::Channel<TrackSequenceId, msecs_t> m_playbackPositionMsecsChanged;
     mutable async::Channel<TrackSequenceId, PlaybackStatus> m_playbackStatusChanged;
 };
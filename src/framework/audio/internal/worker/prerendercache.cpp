@@ -0,0 +1,401 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "prerendercache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__) || defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "concurrency/taskscheduler.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::mpe;
+
+static constexpr samples_t CHUNK_FRAMES = 8192;
+static constexpr samples_t LOOK_AHEAD_CHUNKS = 64; // ~12 seconds at 44.1 kHz
+static constexpr size_t MAX_CACHE_BYTES = 128 * 1024 * 1024; // of all the tracks together
+static constexpr msecs_t NOTE_RELEASE_TIME = 2000000;
+
+static std::atomic<size_t> s_cacheCount = 0;
+
+static void lowerCurrentThreadPriority()
+{
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__APPLE__)
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined(__linux__)
+    sched_param param {};
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+}
+
+//! NOTE The pre-rendering doesn't use the shared task scheduler: the mixer waits on it for the tracks of every block,
+//! a chunk being rendered there (or a resync, rendering many of them) would delay the block
+static TaskScheduler* preRenderScheduler()
+{
+    static TaskScheduler scheduler(1);
+    return &scheduler;
+}
+
+static msecs_t eventsEnd(const msecs_t timestamp, const PlaybackEventList& events)
+{
+    msecs_t end = timestamp;
+
+    for (const PlaybackEvent& event : events) {
+        const ArrangementContext& ctx = std::visit([](const auto& ev) -> const ArrangementContext& {
+            return ev.arrangementCtx();
+        }, event);
+
+        end = std::max(end, ctx.actualTimestamp + ctx.actualDuration);
+    }
+
+    return end;
+}
+
+PreRenderCache::PreRenderCache(synth::ISynthesizerPtr synth, const mpe::PlaybackData& playbackData, unsigned int sampleRate,
+                               audioch_t audioChannelsCount, samples_t renderStep)
+    : m_synth(std::move(synth)), m_sampleRate(sampleRate), m_audioChannelsCount(audioChannelsCount), m_renderStep(renderStep)
+{
+    ++s_cacheCount;
+
+    m_synth->setSampleRate(sampleRate);
+    setPlaybackData(playbackData);
+}
+
+PreRenderCache::~PreRenderCache()
+{
+    stop();
+
+    --s_cacheCount;
+}
+
+void PreRenderCache::stop()
+{
+    m_stopped = true;
+
+    //! NOTE Waits for the chunk being rendered, the synth must be released on the calling thread
+    std::lock_guard synthLock(m_synthMutex);
+    m_synth = nullptr;
+}
+
+bool PreRenderCache::read(const samples_t frame, float* buffer, const samples_t samplesPerChannel)
+{
+    std::unique_lock lock(m_chunksMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+
+    const size_t firstChunkIdx = frame / CHUNK_FRAMES;
+    const size_t lastChunkIdx = (frame + samplesPerChannel - 1) / CHUNK_FRAMES;
+
+    for (size_t idx = firstChunkIdx; idx <= lastChunkIdx; ++idx) {
+        if (m_chunks.find(idx) == m_chunks.cend()) {
+            return false;
+        }
+    }
+
+    samples_t copied = 0;
+    while (copied < samplesPerChannel) {
+        const samples_t currentFrame = frame + copied;
+        const Chunk& chunk = m_chunks.at(currentFrame / CHUNK_FRAMES);
+        const samples_t offset = currentFrame % CHUNK_FRAMES;
+        const samples_t count = std::min(samplesPerChannel - copied, CHUNK_FRAMES - offset);
+
+        std::memcpy(buffer + copied * m_audioChannelsCount, chunk.data() + offset * m_audioChannelsCount,
+                    count * m_audioChannelsCount * sizeof(float));
+
+        copied += count;
+    }
+
+    return true;
+}
+
+void PreRenderCache::renderAhead(const samples_t frame)
+{
+    if (m_stopped || m_jobPending) {
+        return;
+    }
+
+    if (!setupPendingPlaybackData()) {
+        return;
+    }
+
+    const size_t currentChunkIdx = frame / CHUNK_FRAMES;
+    std::optional<size_t> chunkToRender;
+
+    {
+        std::unique_lock lock(m_chunksMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return;
+        }
+
+        m_playbackChunkIdx = currentChunkIdx;
+
+        //! NOTE The share of a track gets smaller when tracks are added, the extra chunks are dropped here
+        evictChunks();
+
+        const size_t lookAheadChunks = std::min<size_t>(LOOK_AHEAD_CHUNKS, maxCachedChunks());
+        for (size_t idx = currentChunkIdx; idx < currentChunkIdx + lookAheadChunks; ++idx) {
+            if (m_chunks.find(idx) == m_chunks.cend()) {
+                chunkToRender = idx;
+                break;
+            }
+        }
+    }
+
+    if (!chunkToRender) {
+        return;
+    }
+
+    //! NOTE One chunk per task, so that a change of the events or of the position is taken into account soon
+    m_jobPending = true;
+    std::weak_ptr<PreRenderCache> weakSelf = weak_from_this();
+    const uint64_t generation = m_generation;
+    const size_t chunkIdx = chunkToRender.value();
+
+    preRenderScheduler()->push([weakSelf, chunkIdx, generation]() {
+        thread_local bool priorityLowered = false;
+        if (!priorityLowered) {
+            lowerCurrentThreadPriority();
+            priorityLowered = true;
+        }
+
+        if (std::shared_ptr<PreRenderCache> self = weakSelf.lock()) {
+            self->renderChunk(chunkIdx, generation);
+            self->m_jobPending = false;
+        }
+    });
+}
+
+void PreRenderCache::setPlaybackData(const mpe::PlaybackData& playbackData)
+{
+    //! NOTE The synth gets its own copy of the events without the change streams,
+    //! it is set up again by the next renderAhead call, when no chunk is being rendered
+    mpe::PlaybackData data;
+    data.setupData = playbackData.setupData;
+    data.originEvents = playbackData.originEvents;
+    data.dynamicLevelMap = playbackData.dynamicLevelMap;
+
+    std::lock_guard lock(m_chunksMutex);
+    m_pendingPlaybackData = std::move(data);
+}
+
+void PreRenderCache::invalidate(const msecs_t from, const msecs_t to)
+{
+    const size_t firstChunkIdx = msecsToFrames(std::max<msecs_t>(from, 0)) / CHUNK_FRAMES;
+    const size_t lastChunkIdx = msecsToFrames(std::max<msecs_t>(to, 0)) / CHUNK_FRAMES;
+
+    std::lock_guard lock(m_chunksMutex);
+
+    ++m_generation;
+
+    auto it = m_chunks.lower_bound(firstChunkIdx);
+    while (it != m_chunks.end() && it->first <= lastChunkIdx) {
+        it = m_chunks.erase(it);
+    }
+}
+
+void PreRenderCache::invalidateAll()
+{
+    std::lock_guard lock(m_chunksMutex);
+
+    ++m_generation;
+    m_chunks.clear();
+}
+
+bool PreRenderCache::setupPendingPlaybackData()
+{
+    //! NOTE Called on the audio worker thread while no render task is pending, so the synth is free.
+    //! The synth binds the callbacks of its channels to the thread of the setup,
+    //! so it must not be set up on the task scheduler threads
+    std::unique_lock synthLock(m_synthMutex, std::try_to_lock);
+    if (!synthLock.owns_lock() || !m_synth) {
+        return false;
+    }
+
+    std::optional<mpe::PlaybackData> data;
+    {
+        std::unique_lock lock(m_chunksMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false;
+        }
+
+        data.swap(m_pendingPlaybackData);
+    }
+
+    if (data) {
+        m_synth->setup(data.value());
+        m_synth->setIsActive(true);
+        m_events = std::move(data->originEvents);
+        m_synthInSync = false;
+    }
+
+    return true;
+}
+
+void PreRenderCache::renderChunk(const size_t chunkIdx, const uint64_t generation)
+{
+    std::lock_guard synthLock(m_synthMutex);
+
+    if (m_stopped || !m_synth || generation != m_generation) {
+        return;
+    }
+
+    //! NOTE Rendering continues from the previous chunk when possible. Otherwise the synth starts
+    //! like after a seek, early enough for the notes still sounding at the chunk to be played,
+    //! the chunks before it are rendered again on the way
+    size_t idx = chunkIdx;
+    if (!m_synthInSync || m_nextSynthFrame != static_cast<samples_t>(chunkIdx * CHUNK_FRAMES)) {
+        idx = resyncChunkIdx(chunkIdx);
+        m_synth->flushSound();
+        m_synth->setPlaybackPosition(framesToMsecs(idx * CHUNK_FRAMES));
+    }
+
+    for (; idx <= chunkIdx; ++idx) {
+        if (m_stopped || generation != m_generation) {
+            m_synthInSync = false;
+            return;
+        }
+
+        Chunk chunk(CHUNK_FRAMES * m_audioChannelsCount, 0.f);
+
+        for (samples_t rendered = 0; rendered < CHUNK_FRAMES; rendered += m_renderStep) {
+            const samples_t count = std::min(m_renderStep, CHUNK_FRAMES - rendered);
+            m_synth->process(chunk.data() + rendered * m_audioChannelsCount, count);
+        }
+
+        m_nextSynthFrame = (idx + 1) * CHUNK_FRAMES;
+        m_synthInSync = true;
+
+        std::lock_guard lock(m_chunksMutex);
+        if (generation == m_generation) {
+            m_chunks.insert_or_assign(idx, std::move(chunk));
+            evictChunks();
+        } else {
+            m_synthInSync = false;
+            return;
+        }
+    }
+}
+
+size_t PreRenderCache::resyncChunkIdx(const size_t chunkIdx) const
+{
+    const msecs_t chunkStart = framesToMsecs(chunkIdx * CHUNK_FRAMES);
+    msecs_t from = chunkStart;
+
+    for (auto it = m_events.cbegin(); it != m_events.cend() && it->first < from; ++it) {
+        for (const PlaybackEvent& event : it->second) {
+            if (!std::holds_alternative<NoteEvent>(event)) {
+                continue;
+            }
+
+            const ArrangementContext& arrangement = std::get<NoteEvent>(event).arrangementCtx();
+            if (arrangement.actualTimestamp + arrangement.actualDuration + NOTE_RELEASE_TIME > chunkStart) {
+                from = std::min(from, arrangement.actualTimestamp);
+            }
+        }
+    }
+
+    return msecsToFrames(std::max<msecs_t>(from, 0)) / CHUNK_FRAMES;
+}
+
+void PreRenderCache::evictChunks()
+{
+    //! NOTE The chunks the farthest from the playback position go first
+    const size_t currentChunkIdx = m_playbackChunkIdx;
+    const size_t maxChunks = maxCachedChunks();
+
+    while (m_chunks.size() > maxChunks) {
+        auto first = m_chunks.begin();
+        auto last = std::prev(m_chunks.end());
+
+        const size_t distanceToFirst = currentChunkIdx > first->first ? currentChunkIdx - first->first : first->first - currentChunkIdx;
+        const size_t distanceToLast = currentChunkIdx > last->first ? currentChunkIdx - last->first : last->first - currentChunkIdx;
+
+        m_chunks.erase(distanceToFirst >= distanceToLast ? first : last);
+    }
+}
+
+size_t PreRenderCache::maxCachedChunks() const
+{
+    const size_t chunkBytes = CHUNK_FRAMES * std::max<size_t>(m_audioChannelsCount, 1) * sizeof(float);
+    const size_t cacheCount = std::max<size_t>(s_cacheCount, 1);
+
+    return std::max<size_t>(MAX_CACHE_BYTES / chunkBytes / cacheCount, 1);
+}
+
+std::optional<std::pair<msecs_t, msecs_t> > PreRenderCache::changedRange(const PlaybackEventsMap& oldEvents,
+                                                                          const PlaybackEventsMap& newEvents)
+{
+    std::optional<std::pair<msecs_t, msecs_t> > range;
+
+    auto extendRange = [&range](const msecs_t from, const msecs_t to) {
+        if (!range) {
+            range = std::make_pair(from, to);
+            return;
+        }
+
+        range->first = std::min(range->first, from);
+        range->second = std::max(range->second, to);
+    };
+
+    auto oldIt = oldEvents.cbegin();
+    auto newIt = newEvents.cbegin();
+
+    while (oldIt != oldEvents.cend() || newIt != newEvents.cend()) {
+        if (newIt == newEvents.cend() || (oldIt != oldEvents.cend() && oldIt->first < newIt->first)) {
+            extendRange(oldIt->first, eventsEnd(oldIt->first, oldIt->second));
+            ++oldIt;
+        } else if (oldIt == oldEvents.cend() || newIt->first < oldIt->first) {
+            extendRange(newIt->first, eventsEnd(newIt->first, newIt->second));
+            ++newIt;
+        } else {
+            if (oldIt->second != newIt->second) {
+                extendRange(oldIt->first, std::max(eventsEnd(oldIt->first, oldIt->second), eventsEnd(newIt->first, newIt->second)));
+            }
+            ++oldIt;
+            ++newIt;
+        }
+    }
+
+    return range;
+}
+
+samples_t PreRenderCache::msecsToFrames(const msecs_t msecs) const
+{
+    return static_cast<samples_t>(msecs * static_cast<double>(m_sampleRate) / 1000000.0);
+}
+
+msecs_t PreRenderCache::framesToMsecs(const samples_t frames) const
+{
+    return static_cast<msecs_t>(frames * 1000000.0 / m_sampleRate);
+}
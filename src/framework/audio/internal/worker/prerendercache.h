@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_PRERENDERCACHE_H
+#define MU_AUDIO_PRERENDERCACHE_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "mpe/events.h"
+
+#include "audiotypes.h"
+#include "isynthesizer.h"
+
+namespace mu::audio {
+//! NOTE Renders a track ahead of the playback position on a low priority thread of its own,
+//! using its own synth instance, so that the playback can take the audio from the cache
+//! instead of rendering it in time. Mostly helps when seeking on heavy scores.
+//! The cache is invalidated by time range when the playback events of the track change.
+//! The memory of the caches of all the tracks together is bounded, each track gets an equal share.
+//! The synth is set up on the audio worker thread, the pre-rendering thread only renders
+class PreRenderCache : public std::enable_shared_from_this<PreRenderCache>
+{
+public:
+    PreRenderCache(synth::ISynthesizerPtr synth, const mpe::PlaybackData& playbackData, unsigned int sampleRate,
+                   audioch_t audioChannelsCount, samples_t renderStep);
+    ~PreRenderCache();
+
+    void stop();
+
+    bool read(const samples_t frame, float* buffer, const samples_t samplesPerChannel);
+    void renderAhead(const samples_t frame);
+
+    void setPlaybackData(const mpe::PlaybackData& playbackData);
+    void invalidate(const msecs_t from, const msecs_t to);
+    void invalidateAll();
+
+    //! NOTE The time range covered by the events that differ, with their durations
+    static std::optional<std::pair<msecs_t, msecs_t> > changedRange(const mpe::PlaybackEventsMap& oldEvents,
+                                                                    const mpe::PlaybackEventsMap& newEvents);
+
+private:
+    using Chunk = std::vector<float>;
+
+    bool setupPendingPlaybackData();
+    void renderChunk(const size_t chunkIdx, const uint64_t generation);
+    size_t resyncChunkIdx(const size_t chunkIdx) const;
+    void evictChunks();
+    size_t maxCachedChunks() const;
+
+    samples_t msecsToFrames(const msecs_t msecs) const;
+    msecs_t framesToMsecs(const samples_t frames) const;
+
+    synth::ISynthesizerPtr m_synth = nullptr;
+    std::optional<mpe::PlaybackData> m_pendingPlaybackData;
+    mpe::PlaybackEventsMap m_events;
+    samples_t m_nextSynthFrame = 0;
+    bool m_synthInSync = false;
+    std::mutex m_synthMutex;
+
+    std::map<size_t, Chunk> m_chunks;
+    size_t m_playbackChunkIdx = 0;
+    std::atomic<uint64_t> m_generation = 0;
+    std::atomic<bool> m_jobPending = false;
+    std::atomic<bool> m_stopped = false;
+    std::mutex m_chunksMutex;
+
+    unsigned int m_sampleRate = 0;
+    audioch_t m_audioChannelsCount = 0;
+    samples_t m_renderStep = 0;
+};
+
+using PreRenderCachePtr = std::shared_ptr<PreRenderCache>;
+}
+
+#endif // MU_AUDIO_PRERENDERCACHE_H
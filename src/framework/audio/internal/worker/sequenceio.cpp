@@ -144,18 +144,18 @@ Channel<TrackId, AudioOutputParams> SequenceIO::outputParamsChanged() const
     return m_outputParamsChanged;
 }
 
-Channel<audioch_t, AudioSignalVal> SequenceIO::audioSignalChanges(const TrackId id) const
+AudioSignalsMeterPtr SequenceIO::audioSignalsMeter(const TrackId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
     IF_ASSERT_FAILED(m_getTracks) {
-        return {};
+        return nullptr;
     }
 
     TrackPtr track = m_getTracks->track(id);
     IF_ASSERT_FAILED(track) {
-        return Channel<audioch_t, AudioSignalVal>();
+        return nullptr;
     }
 
-    return track->outputHandler->audioSignalChanges();
+    return track->outputHandler->audioSignalsMeter();
 }
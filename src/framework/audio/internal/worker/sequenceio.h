@@ -46,7 +46,7 @@ public:
     async::Channel<TrackId, AudioInputParams> inputParamsChanged() const override;
     async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const override;
 
-    async::Channel<audioch_t, AudioSignalVal> audioSignalChanges(const TrackId id) const override;
+    AudioSignalsMeterPtr audioSignalsMeter(const TrackId id) const override;
 
 private:
     IGetTracks* m_getTracks = nullptr;
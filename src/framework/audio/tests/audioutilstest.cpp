@@ -49,3 +49,50 @@ TEST_F(Audio_AudioUtilsTest, AudioPluginTypeFromCategoriesString)
     EXPECT_EQ(AudioPluginType::Undefined, audioPluginTypeFromCategoriesString(u"FX|Test"));
     EXPECT_EQ(AudioPluginType::Undefined, audioPluginTypeFromCategoriesString(u"INSTRUMENT|Test"));
 }
+
+TEST_F(Audio_AudioUtilsTest, SynthEventsLandOnTheSameSampleForAnyBlockSize)
+{
+    //! [GIVEN] Events at some times since the last position change (in microseconds, as msecs_t is)
+    const std::vector<msecs_t> eventTimes = { 0, 1, 22, 23, 999, 1000, 250000, 333333, 1000000, 1234567 };
+    const std::vector<samples_t> blockSizes = { 1, 64, 100, 128, 441, 512, 1000, 1024, 4096 };
+
+    for (sample_rate_t sampleRate : { 44100, 48000 }) {
+        for (samples_t blockSize : blockSizes) {
+            //! [WHEN] The synthesizer renders blocks of the given size, taking the events of each block like the sequencer does
+            std::vector<samples_t> eventSamples(eventTimes.size(), 0);
+            std::vector<bool> played(eventTimes.size(), false);
+
+            msecs_t sequencerPosition = 0;
+            samples_t renderedSamples = 0;
+
+            while (sequencerPosition <= eventTimes.back()) {
+                const SynthBlock block = synthBlock(renderedSamples, blockSize, sampleRate);
+                EXPECT_EQ(block.startMsecs, sequencerPosition);
+
+                for (size_t i = 0; i < eventTimes.size(); ++i) {
+                    const msecs_t time = eventTimes.at(i);
+                    if (time < sequencerPosition || time >= sequencerPosition + block.durationMsecs) {
+                        continue;
+                    }
+
+                    const samples_t offset = synthEventOffset(block, time - sequencerPosition);
+                    EXPECT_LT(offset, blockSize);
+                    EXPECT_FALSE(played.at(i));
+
+                    eventSamples[i] = renderedSamples + offset;
+                    played[i] = true;
+                }
+
+                sequencerPosition += block.durationMsecs;
+                renderedSamples += blockSize;
+            }
+
+            //! [THEN] Every event is played once, at the sample of its time, whatever the block size is
+            for (size_t i = 0; i < eventTimes.size(); ++i) {
+                EXPECT_TRUE(played.at(i));
+                EXPECT_EQ(eventSamples.at(i), msecsToSample(eventTimes.at(i), sampleRate))
+                    << "sample rate: " << sampleRate << ", block size: " << blockSize << ", event time: " << eventTimes.at(i);
+            }
+        }
+    }
+}
@@ -46,6 +46,12 @@ public:
     MOCK_METHOD(async::Notification, driverBufferSizeChanged, (), (const, override));
     MOCK_METHOD(samples_t, renderStep, (), (const, override));
 
+    MOCK_METHOD(bool, isPreRenderEnabled, (), (const, override));
+    MOCK_METHOD(void, setPreRenderEnabled, (bool), (override));
+
+    MOCK_METHOD(int, fluidRenderShards, (), (const, override));
+    MOCK_METHOD(void, setFluidRenderShards, (int), (override));
+
     MOCK_METHOD(unsigned int, sampleRate, (), (const, override));
     MOCK_METHOD(void, setSampleRate, (unsigned int), (override));
     MOCK_METHOD(async::Notification, sampleRateChanged, (), (const, override));
@@ -59,6 +65,8 @@ public:
     MOCK_METHOD(async::Channel<io::paths_t>, soundFontDirectoriesChanged, (), (const, override));
 
     MOCK_METHOD(io::path_t, knownAudioPluginsFilePath, (), (const, override));
+    MOCK_METHOD(io::path_t, soundFontSamplesCachePath, (), (const, override));
+    MOCK_METHOD(io::path_t, soundFontIndexFilePath, (), (const, override));
 };
 }
 
@@ -0,0 +1,179 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "audio/internal/worker/prerendercache.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::synth;
+using namespace mu::mpe;
+
+static constexpr samples_t CHUNK_FRAMES = 8192; // as in prerendercache.cpp
+static constexpr unsigned int SAMPLE_RATE = 8192; // a chunk per second
+static constexpr audioch_t CHANNELS_COUNT = 2;
+
+namespace mu::audio {
+class Audio_PreRenderCacheTest : public ::testing::Test
+{
+public:
+    //! NOTE Renders a constant signal
+    class ConstSynth : public ISynthesizer
+    {
+    public:
+        std::string name() const override { return "const"; }
+        AudioSourceType type() const override { return AudioSourceType::Fluid; }
+        bool isValid() const override { return true; }
+
+        void setup(const PlaybackData&) override {}
+
+        const AudioInputParams& params() const override { return m_params; }
+        async::Channel<AudioInputParams> paramsChanged() const override { return m_paramsChanged; }
+
+        msecs_t playbackPosition() const override { return 0; }
+        void setPlaybackPosition(const msecs_t) override {}
+
+        void revokePlayingNotes() override {}
+        void flushSound() override {}
+
+        bool isActive() const override { return true; }
+        void setIsActive(bool) override {}
+
+        void setSampleRate(unsigned int) override {}
+        unsigned int audioChannelsCount() const override { return CHANNELS_COUNT; }
+        async::Channel<unsigned int> audioChannelsCountChanged() const override { return m_channelsCountChanged; }
+
+        samples_t process(float* buffer, samples_t samplesPerChannel) override
+        {
+            std::fill(buffer, buffer + samplesPerChannel * CHANNELS_COUNT, 1.f);
+            return samplesPerChannel;
+        }
+
+    private:
+        AudioInputParams m_params;
+        async::Channel<AudioInputParams> m_paramsChanged;
+        async::Channel<unsigned int> m_channelsCountChanged;
+    };
+
+    static bool readChunk(PreRenderCache& cache, size_t chunkIdx)
+    {
+        std::vector<float> buffer(CHUNK_FRAMES * CHANNELS_COUNT, 0.f);
+        if (!cache.read(chunkIdx * CHUNK_FRAMES, buffer.data(), CHUNK_FRAMES)) {
+            return false;
+        }
+
+        return std::all_of(buffer.cbegin(), buffer.cend(), [](float v) { return v == 1.f; });
+    }
+
+    static bool renderChunks(PreRenderCache& cache, size_t chunksCount)
+    {
+        for (int attempt = 0; attempt < 5000; ++attempt) {
+            cache.renderAhead(0);
+
+            bool allRendered = true;
+            for (size_t idx = 0; idx < chunksCount && allRendered; ++idx) {
+                allRendered = readChunk(cache, idx);
+            }
+
+            if (allRendered) {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return false;
+    }
+
+    static PlaybackEventsMap events(const std::vector<std::pair<timestamp_t, duration_t> >& rests)
+    {
+        PlaybackEventsMap result;
+        for (const auto& rest : rests) {
+            result[rest.first].emplace_back(RestEvent(rest.first, rest.second, 0));
+        }
+        return result;
+    }
+};
+}
+
+TEST_F(Audio_PreRenderCacheTest, ChangedRange_SameEvents)
+{
+    PlaybackEventsMap evs = events({ { 0, 1000 }, { 1000, 500 } });
+
+    EXPECT_FALSE(PreRenderCache::changedRange(evs, evs).has_value());
+    EXPECT_FALSE(PreRenderCache::changedRange({}, {}).has_value());
+}
+
+TEST_F(Audio_PreRenderCacheTest, ChangedRange_AddedAndRemovedEvents)
+{
+    // [GIVEN] An event is added at 3000 and the one at 1000 is removed
+    PlaybackEventsMap oldEvents = events({ { 0, 1000 }, { 1000, 500 } });
+    PlaybackEventsMap newEvents = events({ { 0, 1000 }, { 3000, 2000 } });
+
+    // [THEN] The range covers both of them, with the duration of the added one
+    std::optional<std::pair<msecs_t, msecs_t> > range = PreRenderCache::changedRange(oldEvents, newEvents);
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->first, 1000);
+    EXPECT_EQ(range->second, 5000);
+}
+
+TEST_F(Audio_PreRenderCacheTest, ChangedRange_ChangedDuration)
+{
+    // [GIVEN] The event at 1000 becomes shorter
+    PlaybackEventsMap oldEvents = events({ { 0, 1000 }, { 1000, 4000 } });
+    PlaybackEventsMap newEvents = events({ { 0, 1000 }, { 1000, 500 } });
+
+    // [THEN] The range ends where the longer one of the two ended
+    std::optional<std::pair<msecs_t, msecs_t> > range = PreRenderCache::changedRange(oldEvents, newEvents);
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->first, 1000);
+    EXPECT_EQ(range->second, 5000);
+}
+
+TEST_F(Audio_PreRenderCacheTest, Invalidate)
+{
+    // [GIVEN] The first three chunks are rendered
+    auto cache = std::make_shared<PreRenderCache>(std::make_shared<ConstSynth>(), PlaybackData(), SAMPLE_RATE, CHANNELS_COUNT, 512);
+    ASSERT_TRUE(renderChunks(*cache, 3));
+
+    // [WHEN] The second second is invalidated
+    cache->invalidate(1000000, 1500000);
+
+    // [THEN] Only its chunk is dropped
+    EXPECT_TRUE(readChunk(*cache, 0));
+    EXPECT_FALSE(readChunk(*cache, 1));
+    EXPECT_TRUE(readChunk(*cache, 2));
+
+    // [WHEN] Everything is invalidated
+    cache->invalidateAll();
+
+    // [THEN] Nothing is read from the cache
+    EXPECT_FALSE(readChunk(*cache, 0));
+    EXPECT_FALSE(readChunk(*cache, 2));
+
+    cache->stop();
+}
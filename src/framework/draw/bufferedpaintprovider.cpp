@@ -44,6 +44,7 @@ void BufferedPaintProvider::beginTarget(const std::string& name)
     m_buf->name = name;
     m_stateIsUsed = false;
     m_currentStateNo = 0;
+    m_savedStates = std::stack<DrawData::State>();
     m_buf->states[m_currentStateNo] = DrawData::State(); // default
     beginObject("target_" + name);
     m_isActive = true;
@@ -250,10 +251,22 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    IF_ASSERT_FAILED(!m_savedStates.empty()) {
+        return;
+    }
+
+    //! NOTE Each data refers to the whole state, so restoring means just continuing with the saved one
+    DrawData::State saved = m_savedStates.top();
+    m_savedStates.pop();
+
+    if (saved != currentState()) {
+        editableState() = saved;
+    }
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -302,8 +315,9 @@ void BufferedPaintProvider::drawText(const RectF& rect, int flags, const String&
 
 void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
 {
+    //! NOTE Whether the workaround applies depends on the scale, which is known only when the data is replayed
     setFont(f);
-    drawText(pos, text);
+    editableData().texts.push_back(DrawText { DrawText::Point, RectF(pos, SizeF()), 0, text, true });
 }
 
 void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
@@ -334,19 +348,28 @@ void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm
 
 #endif
 
+void BufferedPaintProvider::drawSvg(const RectF& rect, std::shared_ptr<SvgRenderer> renderer)
+{
+    editableData().svgs.push_back(DrawSvg { rect, std::move(renderer) });
+}
+
 bool BufferedPaintProvider::hasClipping() const
 {
-    return false;
+    return currentState().isClipping;
 }
 
 void BufferedPaintProvider::setClipRect(const RectF& rect)
 {
-    UNUSED(rect);
+    //! NOTE Like QPainter, the clip rect is mapped by the current transform, the later transforms don't move it
+    DrawData::State& st = editableState();
+    st.isClipping = true;
+    st.clipRect = rect;
+    st.clipTransform = st.transform;
 }
 
 void BufferedPaintProvider::setClipping(bool enable)
 {
-    UNUSED(enable);
+    editableState().isClipping = enable;
 }
 
 DrawDataPtr BufferedPaintProvider::drawData() const
@@ -85,6 +85,9 @@ public:
     void drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset = PointF()) override;
 #endif
 
+    //! NOTE Not a part of IPaintProvider, the SvgRenderer records itself when the provider is buffered
+    void drawSvg(const RectF& rect, std::shared_ptr<SvgRenderer> renderer);
+
     bool hasClipping() const override;
 
     void setClipRect(const RectF& rect) override;
@@ -112,6 +115,7 @@ private:
     int m_itemLevel = -1;
     bool m_stateIsUsed = false;
     int m_currentStateNo = 0;
+    std::stack<DrawData::State> m_savedStates;
     bool m_isActive = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
 };
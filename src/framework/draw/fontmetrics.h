@@ -32,7 +32,7 @@
 namespace mu::draw {
 class FontMetrics
 {
-    INJECT(IFontProvider, fontProvider)
+    INJECT_STATIC(IFontProvider, fontProvider)
 public:
     FontMetrics(const Font& font);
 
@@ -21,7 +21,7 @@
  */
 #include "fontengineft.h"
 
-#include <QHash>
+#include <unordered_map>
 
 #include "io/file.h"
 
@@ -59,7 +59,7 @@ struct mu::draw::FTData
 {
     ByteArray fontData;
     FT_Face face = nullptr;
-    QHash<char32_t, FTGlyphMetrics> metrics;
+    std::unordered_map<char32_t, FTGlyphMetrics> metrics;
 };
 
 FontEngineFT::FontEngineFT()
@@ -69,6 +69,9 @@ FontEngineFT::FontEngineFT()
 
 FontEngineFT::~FontEngineFT()
 {
+    if (m_data->face) {
+        FT_Done_Face(m_data->face);
+    }
     delete m_data;
 }
 
@@ -96,12 +99,34 @@ bool FontEngineFT::load(const io::path_t& path)
     double pixelSize = 200.0;
     FT_Set_Pixel_Sizes(m_data->face, 0, int(pixelSize + .5));
 
+    FT_UInt index = 0;
+    for (FT_ULong ucs4 = FT_Get_First_Char(m_data->face, &index); index != 0;
+         ucs4 = FT_Get_Next_Char(m_data->face, ucs4, &index)) {
+        if (FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0) {
+            continue;
+        }
+
+        FT_BBox bb;
+        if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
+            continue;
+        }
+
+        FTGlyphMetrics& gm = m_data->metrics[static_cast<char32_t>(ucs4)];
+        gm.bb = bb;
+        gm.linearHoriAdvance = m_data->face->glyph->linearHoriAdvance;
+    }
+
+    //! NOTE All metrics are read, the face and the font data are no longer needed
+    FT_Done_Face(m_data->face);
+    m_data->face = nullptr;
+    m_data->fontData = ByteArray();
+
     return true;
 }
 
 QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return QRectF();
     }
@@ -116,7 +141,7 @@ QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 
 double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return 0.0;
     }
@@ -125,29 +150,12 @@ double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
     return gm->linearHoriAdvance * dpi_f / 655360.0;
 }
 
-FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
+const FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
 {
-    if (m_data->metrics.contains(ucs4)) {
-        return &m_data->metrics[ucs4];
-    }
-
-    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
-    if (index == 0) {
+    auto it = m_data->metrics.find(ucs4);
+    if (it == m_data->metrics.end()) {
         return nullptr;
     }
 
-    if (FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0) {
-        return nullptr;
-    }
-
-    FT_BBox bb;
-    if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
-        return nullptr;
-    }
-
-    FTGlyphMetrics& gm = m_data->metrics[ucs4];
-    gm.bb = bb;
-    gm.linearHoriAdvance = m_data->face->glyph->linearHoriAdvance;
-
-    return &gm;
+    return &it->second;
 }
@@ -35,6 +35,8 @@ public:
     FontEngineFT();
     ~FontEngineFT();
 
+    //! NOTE The metrics of all glyphs of the font are read on load,
+    //! after that the engine is immutable and can be used from several threads without locking
     bool load(const io::path_t& path);
 
     QRectF bbox(char32_t ucs4, double DPI_F) const;
@@ -42,7 +44,7 @@ public:
 
 private:
 
-    FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    const FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
 
     FTData* m_data = nullptr;
 };
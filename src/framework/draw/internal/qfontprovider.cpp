@@ -57,16 +57,19 @@ static FontPaintDevice device;
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
     m_symbolsFonts[family] = path;
+    m_textMetricsCache.clear();
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 int QFontProvider::addTextFont(const io::path_t& path)
 {
+    m_textMetricsCache.clear();
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 void QFontProvider::insertSubstitution(const String& familyName, const String& substituteName)
 {
+    m_textMetricsCache.clear();
     QFont::insertSubstitution(familyName, substituteName);
 }
 
@@ -114,7 +117,9 @@ bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    return m_textMetricsCache.metric(f, TextMetricsCache::Metric::HorizontalAdvance, string, [&f, &string]() {
+        return RectF(0.0, 0.0, QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string), 0.0);
+    }).width();
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
@@ -124,7 +129,9 @@ double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return m_textMetricsCache.metric(f, TextMetricsCache::Metric::BoundingRect, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
@@ -139,7 +146,9 @@ RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, cons
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    return m_textMetricsCache.metric(f, TextMetricsCache::Metric::TightBoundingRect, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    });
 }
 
 // Score symbols
@@ -204,6 +213,8 @@ FontEngineFT* QFontProvider::symEngine(const Font& f) const
         return nullptr;
     }
 
+    std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+
     FontEngineFT* engine = m_symEngines.value(path, nullptr);
     if (!engine) {
         engine = new FontEngineFT();
@@ -22,9 +22,12 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <mutex>
+
 #include <QHash>
 
 #include "../ifontprovider.h"
+#include "textmetricscache.h"
 
 namespace mu::draw {
 class FontEngineFT;
@@ -65,6 +68,11 @@ private:
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+    //! NOTE The engines are created on demand, once loaded they are immutable
+    mutable std::mutex m_symEnginesMutex;
+
+    //! NOTE Cleared when fonts are added or substituted
+    mutable TextMetricsCache m_textMetricsCache;
 };
 }
 
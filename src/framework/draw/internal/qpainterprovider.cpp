@@ -242,8 +242,16 @@ void QPainterProvider::drawText(const RectF& rect, int flags, const String& text
 
 void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
 {
-    m_painter->save();
+    //! NOTE Only needed when scaled down, the scale is checked here because
+    //! the text may have been recorded at another scale than the one it is painted at
     double mm = m_painter->worldTransform().m11();
+    if (mm >= 1.0) {
+        setFont(f);
+        drawText(pos, text);
+        return;
+    }
+
+    m_painter->save();
     double dx = m_painter->worldTransform().dx();
     double dy = m_painter->worldTransform().dy();
     // diagonal elements will now be changed to 1.0
@@ -303,7 +311,7 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
+    thread_local QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textmetricscache.h"
+
+#include <algorithm>
+
+using namespace mu;
+using namespace mu::draw;
+
+static inline void hashCombine(size_t& seed, size_t h)
+{
+    seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+bool TextMetricsCache::Key::operator==(const Key& k) const
+{
+    //! NOTE Font::operator== does not compare the pixel size, and compares the point size approximately.
+    //! The hash takes the exact point size, so the equal keys must have the exact same one
+    return metric == k.metric
+           && font == k.font
+           && font.pointSizeF() == k.font.pointSizeF()
+           && font.pixelSize() == k.font.pixelSize()
+           && string == k.string;
+}
+
+size_t TextMetricsCache::KeyHash::operator()(const Key& k) const
+{
+    size_t seed = k.string.hash();
+    hashCombine(seed, k.font.family().hash());
+    hashCombine(seed, std::hash<double> {}(k.font.pointSizeF()));
+    hashCombine(seed, std::hash<int> {}(k.font.pixelSize()));
+    hashCombine(seed, std::hash<int> {}(static_cast<int>(k.font.weight())));
+    hashCombine(seed, std::hash<int> {}(static_cast<int>(k.metric)));
+    return seed;
+}
+
+TextMetricsCache::TextMetricsCache(size_t capacity)
+    : m_shardCapacity(std::max<size_t>(1, capacity / SHARD_COUNT))
+{
+}
+
+TextMetricsCache::Shard& TextMetricsCache::shard(size_t hash)
+{
+    //! NOTE The low bits are used by the buckets of the shard's index
+    return m_shards[(hash >> 16) % SHARD_COUNT];
+}
+
+RectF TextMetricsCache::metric(const Font& font, Metric metric, const String& string, const std::function<RectF()>& func)
+{
+    Key key { font, string, metric };
+    const size_t hash = KeyHash {}(key);
+    Shard& s = shard(hash);
+
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto it = s.index.find(key);
+        if (it != s.index.end()) {
+            s.lru.splice(s.lru.begin(), s.lru, it->second);
+            return it->second->second;
+        }
+    }
+
+    RectF value = func();
+
+    std::lock_guard<std::mutex> lock(s.mutex);
+    auto it = s.index.find(key);
+    if (it != s.index.end()) {
+        // computed concurrently by another thread
+        s.lru.splice(s.lru.begin(), s.lru, it->second);
+        return value;
+    }
+
+    s.lru.emplace_front(std::move(key), value);
+    s.index.emplace(s.lru.front().first, s.lru.begin());
+
+    if (s.lru.size() > m_shardCapacity) {
+        s.index.erase(s.lru.back().first);
+        s.lru.pop_back();
+    }
+
+    return value;
+}
+
+void TextMetricsCache::clear()
+{
+    for (Shard& s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.index.clear();
+        s.lru.clear();
+    }
+}
+
+size_t TextMetricsCache::size() const
+{
+    size_t count = 0;
+    for (const Shard& s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        count += s.lru.size();
+    }
+    return count;
+}
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_TEXTMETRICSCACHE_H
+#define MU_DRAW_TEXTMETRICSCACHE_H
+
+#include <array>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "../types/font.h"
+#include "../types/geometry.h"
+#include "types/string.h"
+
+namespace mu::draw {
+//! NOTE Bounded LRU cache of the metrics of text runs, keyed by the font and the string.
+//! Text layout measures the same strings (lyrics syllables, chord symbols, fingerings...)
+//! with the same fonts again and again, and each measurement goes to the font engine.
+//! The cache is split into shards with their own lock, so concurrent layouts rarely wait for each other
+class TextMetricsCache
+{
+public:
+    enum class Metric : uint8_t {
+        HorizontalAdvance,  // the advance is stored as the width of the rect
+        BoundingRect,
+        TightBoundingRect
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 32768;
+
+    TextMetricsCache(size_t capacity = DEFAULT_CAPACITY);
+
+    //! NOTE Returns the cached value or computes it with `func` (without holding the lock) and caches it
+    RectF metric(const Font& font, Metric metric, const String& string, const std::function<RectF()>& func);
+
+    void clear();
+    size_t size() const;
+
+private:
+    struct Key {
+        Font font;
+        String string;
+        Metric metric = Metric::HorizontalAdvance;
+
+        bool operator==(const Key& k) const;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const;
+    };
+
+    using Entry = std::pair<Key, RectF>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> lru; // most recently used first
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    static constexpr size_t SHARD_COUNT = 16;
+
+    Shard& shard(size_t hash);
+
+    std::array<Shard, SHARD_COUNT> m_shards;
+    size_t m_shardCapacity = 0;
+};
+}
+
+#endif // MU_DRAW_TEXTMETRICSCACHE_H
@@ -133,6 +133,36 @@ void Painter::endObject()
     }
 }
 
+bool Painter::isPrinting() const
+{
+    return m_isPrinting;
+}
+
+void Painter::setIsPrinting(bool arg)
+{
+    m_isPrinting = arg;
+}
+
+bool Painter::isSvgPrinting() const
+{
+    return m_isSvgPrinting;
+}
+
+void Painter::setIsSvgPrinting(bool arg)
+{
+    m_isSvgPrinting = arg;
+}
+
+double Painter::pixelRatio() const
+{
+    return m_pixelRatio;
+}
+
+void Painter::setPixelRatio(double ratio)
+{
+    m_pixelRatio = ratio;
+}
+
 void Painter::setAntialiasing(bool arg)
 {
     m_provider->setAntialiasing(arg);
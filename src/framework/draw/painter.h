@@ -65,6 +65,15 @@ public:
     void beginObject(const std::string& name);
     void endObject();
 
+    //! NOTE The context of the paint, set up by the caller and read by the painted items,
+    //! so that several paints can run at once
+    bool isPrinting() const;
+    void setIsPrinting(bool arg);         // printing or exporting, the items shown only on screen are skipped
+    bool isSvgPrinting() const;
+    void setIsSvgPrinting(bool arg);
+    double pixelRatio() const;
+    void setPixelRatio(double ratio);     // DPI of the painted items / DPI of the device
+
     // state
     void setAntialiasing(bool arg);
     void setCompositionMode(CompositionMode mode);
@@ -199,6 +208,10 @@ private:
     IPaintProviderPtr m_provider;
     std::string m_name;
     std::stack<State> m_states;
+
+    bool m_isPrinting = false;
+    bool m_isSvgPrinting = false;
+    double m_pixelRatio = 1.0;
 };
 
 inline void Painter::setPen(const Color& color)
@@ -26,6 +26,7 @@
 #include <QSvgRenderer>
 
 #include "internal/qpainterprovider.h"
+#include "bufferedpaintprovider.h"
 #endif
 
 #include "log.h"
@@ -35,6 +36,7 @@ using namespace mu::draw;
 //! NOTE Perhaps in the future we need to add something like ISvgRenderer
 
 SvgRenderer::SvgRenderer(const ByteArray& data)
+    : m_data(data)
 {
 #ifndef DRAW_NO_QSVGRENDER
     m_qSvgRenderer = new QSvgRenderer(data.toQByteArray());
@@ -68,6 +70,13 @@ void SvgRenderer::render(Painter* painter, const RectF& rect)
     std::shared_ptr<QPainterProvider> qPaintProvider = std::dynamic_pointer_cast<QPainterProvider>(paintProvider);
     if (qPaintProvider) {
         m_qSvgRenderer->render(qPaintProvider->qpainter(), rect.toQRectF());
+        return;
+    }
+
+    //! NOTE The recorded renderer is a copy, the draw data may outlive this one (e.g. the image is deleted)
+    std::shared_ptr<BufferedPaintProvider> bufferedProvider = std::dynamic_pointer_cast<BufferedPaintProvider>(paintProvider);
+    if (bufferedProvider) {
+        bufferedProvider->drawSvg(rect, std::make_shared<SvgRenderer>(m_data));
     }
 #else
     NOT_SUPPORTED;
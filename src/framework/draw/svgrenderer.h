@@ -37,9 +37,11 @@ public:
 
     SizeF defaultSize() const;
 
+    //! NOTE Painted with a QPainter, recorded into the draw data with a buffered provider
     void render(Painter* painter, const RectF& rect);
 
 private:
+    ByteArray m_data;
     QSvgRenderer* m_qSvgRenderer = nullptr;
 };
 }
@@ -25,6 +25,9 @@
 #include <QImage>
 
 #include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/svgrenderer.h"
+#include "draw/utils/drawdatapaint.h"
 
 #include "draw/internal/qpainterprovider.h"
 
@@ -156,3 +159,32 @@ TEST_F(Draw_PainterTests, Painter_SaveRestore)
 
     EXPECT_EQ(painter.provider()->transform(), worldTransform * expectedViewTransform);
 }
+
+TEST_F(Draw_PainterTests, BufferedPainter_ReplaySvgWithClip)
+{
+    //! GIVEN An SVG image recorded by a buffered provider, with a clip over its left half
+    ByteArray svgData("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"10\" height=\"10\">"
+                      "<rect width=\"10\" height=\"10\" fill=\"#ff0000\"/></svg>");
+    SvgRenderer svg(svgData);
+
+    auto recorder = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(recorder, "test");
+        painter.setClipRect(RectF(0.0, 0.0, 50.0, 100.0));
+        svg.render(&painter, RectF(0.0, 0.0, 100.0, 100.0));
+        painter.endDraw();
+    }
+
+    //! DO Replay the recorded data on an image
+    QImage pd(100, 100, QImage::Format_ARGB32_Premultiplied);
+    pd.fill(Qt::white);
+    {
+        QPainter qp(&pd);
+        Painter painter(&qp, "test");
+        DrawDataPaint::paint(&painter, recorder->drawData());
+    }
+
+    //! CHECK The image is painted, inside the clip only
+    EXPECT_EQ(pd.pixelColor(25, 50), QColor(Qt::red));
+    EXPECT_EQ(pd.pixelColor(75, 50), QColor(Qt::white));
+}
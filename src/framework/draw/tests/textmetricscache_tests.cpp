@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "draw/internal/textmetricscache.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_TextMetricsCacheTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Draw_TextMetricsCacheTests, ComputedOnce)
+{
+    //! GIVEN Empty cache
+    TextMetricsCache cache;
+    Font font(u"Edwin", Font::Type::Text);
+    font.setPointSizeF(10.0);
+
+    int computed = 0;
+    auto func = [&computed]() {
+        ++computed;
+        return RectF(1.0, 2.0, 3.0, 4.0);
+    };
+
+    //! DO Request the same metric twice
+    RectF r1 = cache.metric(font, TextMetricsCache::Metric::BoundingRect, u"Allelujah", func);
+    RectF r2 = cache.metric(font, TextMetricsCache::Metric::BoundingRect, u"Allelujah", func);
+
+    //! CHECK Computed only once
+    EXPECT_EQ(computed, 1);
+    EXPECT_EQ(r1, RectF(1.0, 2.0, 3.0, 4.0));
+    EXPECT_EQ(r2, r1);
+
+    //! DO Request another metric, another string and another font
+    cache.metric(font, TextMetricsCache::Metric::TightBoundingRect, u"Allelujah", func);
+    cache.metric(font, TextMetricsCache::Metric::BoundingRect, u"Kyrie", func);
+
+    Font bigger(font);
+    bigger.setPointSizeF(12.0);
+    cache.metric(bigger, TextMetricsCache::Metric::BoundingRect, u"Allelujah", func);
+
+    //! CHECK Each of them is computed
+    EXPECT_EQ(computed, 4);
+    EXPECT_EQ(cache.size(), 4u);
+
+    //! DO Clear
+    cache.clear();
+    cache.metric(font, TextMetricsCache::Metric::BoundingRect, u"Allelujah", func);
+
+    //! CHECK Computed again
+    EXPECT_EQ(computed, 5);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(Draw_TextMetricsCacheTests, Bounded)
+{
+    //! GIVEN Small cache
+    TextMetricsCache cache(64);
+    Font font(u"Edwin", Font::Type::Text);
+
+    //! DO Put much more strings than it can hold
+    for (int i = 0; i < 1000; ++i) {
+        cache.metric(font, TextMetricsCache::Metric::HorizontalAdvance, String::number(i), [i]() {
+            return RectF(0.0, 0.0, i, 0.0);
+        });
+    }
+
+    //! CHECK The size is bounded and the values are right
+    EXPECT_LE(cache.size(), 64u);
+
+    int computed = 0;
+    RectF r = cache.metric(font, TextMetricsCache::Metric::HorizontalAdvance, String::number(999), [&computed]() {
+        ++computed;
+        return RectF();
+    });
+
+    //! CHECK The most recent string is still there
+    EXPECT_EQ(computed, 0);
+    EXPECT_EQ(r.width(), 999.0);
+}
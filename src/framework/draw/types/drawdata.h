@@ -34,6 +34,8 @@
 #include "painterpath.h"
 
 namespace mu::draw {
+class SvgRenderer;
+
 enum class DrawMode {
     Stroke = 0,
     Fill,
@@ -83,9 +85,10 @@ struct DrawText {
     RectF rect;     // If mode is Point when use topLeft point
     int flags = 0;
     String text;
+    bool isWorkaround = false; // drawn with drawTextWorkaround, which depends on the scale of the replay
     bool operator==(const DrawText& o) const
     {
-        return mode == o.mode && flags == o.flags && rect == o.rect && text == o.text;
+        return mode == o.mode && flags == o.flags && rect == o.rect && text == o.text && isWorkaround == o.isWorkaround;
     }
 
     bool operator!=(const DrawText& o) const { return !this->operator==(o); }
@@ -104,6 +107,11 @@ struct DrawPixmap {
     PointF offset;  // used only for Tiled mode
 };
 
+struct DrawSvg {
+    RectF rect;
+    std::shared_ptr<SvgRenderer> renderer;
+};
+
 struct DrawData
 {
     static const int CANVAS_DPI = 360;
@@ -115,11 +123,15 @@ struct DrawData
         Transform transform;
         bool isAntialiasing = false;
         CompositionMode compositionMode = CompositionMode::SourceOver;
+        bool isClipping = false;
+        RectF clipRect;             // in the coordinates of clipTransform
+        Transform clipTransform;    // the transform at the time the clip rect was set
 
         bool operator==(const State& o) const
         {
             return pen == o.pen && brush == o.brush && font == o.font && transform == o.transform
-                   && isAntialiasing == o.isAntialiasing && compositionMode == o.compositionMode;
+                   && isAntialiasing == o.isAntialiasing && compositionMode == o.compositionMode
+                   && isClipping == o.isClipping && clipRect == o.clipRect && clipTransform == o.clipTransform;
         }
 
         bool operator!=(const State& o) const { return !this->operator==(o); }
@@ -132,8 +144,9 @@ struct DrawData
         std::vector<DrawPolygon> polygons;
         std::vector<DrawText> texts;
         std::vector<DrawPixmap> pixmaps;
+        std::vector<DrawSvg> svgs;
 
-        bool empty() const { return paths.empty() && polygons.empty() && texts.empty() && pixmaps.empty(); }
+        bool empty() const { return paths.empty() && polygons.empty() && texts.empty() && pixmaps.empty() && svgs.empty(); }
     };
 
     struct Item {
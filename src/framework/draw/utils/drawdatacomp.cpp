@@ -247,6 +247,16 @@ static bool isEqual(const DrawData::State& s1, const DrawData::State& s2, DrawDa
         return false;
     }
 
+    if (s1.isClipping != s2.isClipping) {
+        return false;
+    }
+
+    if (s1.isClipping) {
+        if (!isEqual(s1.clipRect, s2.clipRect, tolerance.base) || !isEqual(s1.clipTransform, s2.clipTransform, tolerance.base)) {
+            return false;
+        }
+    }
+
     return true;
 }
 
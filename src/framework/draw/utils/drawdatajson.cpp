@@ -183,6 +183,10 @@ static JsonObject toObj(const DrawData::State& st)
     obj["isAntialiasing"] = st.isAntialiasing;
     obj["transform"] = toArr(st.transform);
     obj["compositionMode"] = static_cast<int>(st.compositionMode);
+    if (st.isClipping) {
+        obj["clipRect"] = toArr(st.clipRect);
+        obj["clipTransform"] = toArr(st.clipTransform);
+    }
     return obj;
 }
 
@@ -194,6 +198,11 @@ static void fromObj(const JsonObject& obj, DrawData::State& st)
     st.isAntialiasing = obj["isAntialiasing"].toBool();
     fromArr(obj["transform"].toArray(), st.transform);
     st.compositionMode = static_cast<CompositionMode>(obj["compositionMode"].toInt());
+    st.isClipping = obj.contains("clipRect");
+    if (st.isClipping) {
+        fromArr(obj["clipRect"].toArray(), st.clipRect);
+        fromArr(obj["clipTransform"].toArray(), st.clipTransform);
+    }
 }
 
 static JsonObject toObj(const PainterPath& path)
@@ -320,6 +329,9 @@ static JsonObject toObj(const DrawText& text)
     }
     o["flags"] = text.flags;
     o["text"] = text.text;
+    if (text.isWorkaround) {
+        o["workaround"] = true;
+    }
     return o;
 }
 
@@ -336,6 +348,7 @@ static void fromObj(const JsonObject& obj, DrawText& text)
     }
     text.flags = obj["flags"].toInt();
     text.text = obj["text"].toString();
+    text.isWorkaround = obj["workaround"].toBool();
 }
 
 static JsonObject toObj(const DrawPixmap& pm)
@@ -21,13 +21,41 @@
  */
 #include "drawdatapaint.h"
 
+#include "../svgrenderer.h"
+
 #include "log.h"
 
 using namespace mu;
 using namespace mu::draw;
 
-static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
-                     const Color& overlay)
+struct ReplayedClip {
+    bool isClipping = false;
+    RectF rect;
+    Transform transform;
+};
+
+//! NOTE The clipping of the target is left as it is until the recorded data changes the clipping
+static void applyClip(IPaintProviderPtr& provider, const DrawData::State& st, ReplayedClip& replayed, const Transform* base)
+{
+    if (st.isClipping == replayed.isClipping) {
+        if (!st.isClipping || (st.clipRect == replayed.rect && st.clipTransform == replayed.transform)) {
+            return;
+        }
+    }
+
+    if (st.isClipping) {
+        provider->setTransform(base ? st.clipTransform * (*base) : st.clipTransform);
+        provider->setClipRect(st.clipRect);
+    } else {
+        provider->setClipping(false);
+    }
+
+    replayed = { st.isClipping, st.clipRect, st.clipTransform };
+}
+
+static void drawItem(Painter* painter, IPaintProviderPtr& provider, const DrawData::Item& item,
+                     const std::map<int, DrawData::State>& states, const Color& overlay, ReplayedClip& clip,
+                     const Transform* base = nullptr)
 {
     // first draw obj itself
     for (const DrawData::Data& d : item.datas) {
@@ -37,10 +65,12 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
             st.brush.setColor(overlay);
         }
 
+        applyClip(provider, st, clip, base);
+
         provider->setPen(st.pen);
         provider->setBrush(st.brush);
         provider->setFont(st.font);
-        provider->setTransform(st.transform);
+        provider->setTransform(base ? st.transform * (*base) : st.transform);
         provider->setAntialiasing(st.isAntialiasing);
         provider->setCompositionMode(st.compositionMode);
 
@@ -58,7 +88,9 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
         }
 
         for (const DrawText& t : d.texts) {
-            if (t.mode == DrawText::Point) {
+            if (t.isWorkaround) {
+                provider->drawTextWorkaround(st.font, t.rect.topLeft(), t.text);
+            } else if (t.mode == DrawText::Point) {
                 provider->drawText(t.rect.topLeft(), t.text);
             } else {
                 provider->drawText(t.rect, t.flags, t.text);
@@ -72,16 +104,38 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
                 provider->drawTiledPixmap(px.rect, px.pm, px.offset);
             }
         }
+
+        for (const DrawSvg& svg : d.svgs) {
+            if (svg.renderer) {
+                svg.renderer->render(painter, svg.rect);
+            }
+        }
     }
 
     // second draw chilren
     for (const DrawData::Item& ch : item.chilren) {
-        drawItem(provider, ch, states, overlay);
+        drawItem(painter, provider, ch, states, overlay, clip, base);
     }
 }
 
 void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const Color& overlay)
 {
     IPaintProviderPtr provider = painter->provider();
-    drawItem(provider, data->item, data->states, overlay);
+    ReplayedClip clip;
+    drawItem(painter, provider, data->item, data->states, overlay, clip);
+
+    if (clip.isClipping) {
+        provider->setClipping(false);
+    }
+}
+
+void DrawDataPaint::paintItem(Painter* painter, const DrawDataPtr& data, const DrawData::Item& item, const Transform& base)
+{
+    IPaintProviderPtr provider = painter->provider();
+    ReplayedClip clip;
+    drawItem(painter, provider, item, data->states, Color(), clip, &base);
+
+    if (clip.isClipping) {
+        provider->setClipping(false);
+    }
 }
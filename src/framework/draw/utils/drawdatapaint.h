@@ -32,6 +32,10 @@ public:
     DrawDataPaint() = default;
 
     static void paint(Painter* painter, const DrawDataPtr& data, const Color& overlay = Color());
+
+    //! NOTE Replays one recorded item (with its children) with the recorded transforms applied on top of base.
+    //! The provider state is changed directly, so the caller should save and restore the painter around it
+    static void paintItem(Painter* painter, const DrawDataPtr& data, const DrawData::Item& item, const Transform& base);
 };
 }
 
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_PARALLELFOR_H
+#define MU_GLOBAL_PARALLELFOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace mu {
+//! NOTE Calls func for each index in [from, to), on as many threads as there are cores.
+//! The calling thread takes part in the work, returns when all the indexes are processed
+inline void parallelFor(size_t from, size_t to, const std::function<void(size_t)>& func)
+{
+    if (from >= to) {
+        return;
+    }
+
+    const size_t threadCount = std::min(to - from, static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+    std::atomic<size_t> next = from;
+
+    auto worker = [&next, to, &func]() {
+        for (size_t i = next++; i < to; i = next++) {
+            func(i);
+        }
+    };
+
+    std::vector<std::future<void> > workers;
+    for (size_t i = 1; i < threadCount; ++i) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+
+    worker();
+
+    for (std::future<void>& w : workers) {
+        w.wait();
+    }
+}
+}
+
+#endif // MU_GLOBAL_PARALLELFOR_H
@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_SPSCQUEUE_H
+#define MU_GLOBAL_SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace mu {
+//! NOTE Wait-free queue of fixed-size records between exactly one producer thread and one consumer thread.
+//! Neither side allocates or locks: push fails when the queue is full, pop fails when it is empty
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SpscQueue records must be trivially copyable");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    //! NOTE Producer thread only
+    bool push(const T& item)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! NOTE Consumer thread only
+    bool pop(T& item)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        item = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool empty() const
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity()
+    {
+        return Capacity;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    //! NOTE The indexes only grow, the slot is the index modulo the capacity.
+    //! They live on separate cache lines, so the two threads don't invalidate each other's line on every call
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail = 0;
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_items {};
+};
+}
+
+#endif // MU_GLOBAL_SPSCQUEUE_H
@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mappedfile.h"
+
+#ifndef NO_QT_SUPPORT
+#include <QFile>
+#endif
+
+#include "ioretcodes.h"
+
+#include "log.h"
+
+using namespace mu::io;
+
+struct MappedFile::Mapping {
+#ifndef NO_QT_SUPPORT
+    QFile file;
+#endif
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+MappedFile::MappedFile(const path_t& filePath)
+    : m_filePath(filePath)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+    unmap();
+}
+
+path_t MappedFile::filePath() const
+{
+    return m_filePath;
+}
+
+bool MappedFile::isMapped() const
+{
+    return m_mapping != nullptr;
+}
+
+bool MappedFile::doOpen(OpenMode m)
+{
+    if (m != OpenMode::ReadOnly) {
+        setError(int(Err::FSWriteError), "Mapped file can be opened only for reading");
+        return false;
+    }
+
+    unmap();
+    m_data = ByteArray();
+
+#ifndef NO_QT_SUPPORT
+    std::unique_ptr<Mapping> mapping = std::make_unique<Mapping>();
+    mapping->file.setFileName(m_filePath.toQString());
+    if (mapping->file.open(QIODevice::ReadOnly)) {
+        qint64 size = mapping->file.size();
+        uchar* data = size > 0 ? mapping->file.map(0, size) : nullptr;
+        if (data) {
+            mapping->data = data;
+            mapping->size = static_cast<size_t>(size);
+            m_mapping = std::move(mapping);
+            return true;
+        }
+    }
+#endif
+
+    //! NOTE Fallback, e.g. for empty files or file systems without mapping support
+    Ret ret = fileSystem()->readFile(m_filePath, m_data);
+    if (!ret) {
+        setError(ret.code(), ret.text());
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::unmap()
+{
+    if (!m_mapping) {
+        return;
+    }
+
+#ifndef NO_QT_SUPPORT
+    m_mapping->file.unmap(const_cast<uchar*>(m_mapping->data));
+    m_mapping->file.close();
+#endif
+
+    m_mapping.reset();
+}
+
+size_t MappedFile::dataSize() const
+{
+    return m_mapping ? m_mapping->size : m_data.size();
+}
+
+const uint8_t* MappedFile::rawData() const
+{
+    return m_mapping ? m_mapping->data : m_data.constData();
+}
+
+bool MappedFile::resizeData(size_t)
+{
+    NOT_SUPPORTED;
+    return false;
+}
+
+size_t MappedFile::writeData(const uint8_t*, size_t)
+{
+    NOT_SUPPORTED;
+    return 0;
+}
@@ -149,6 +149,43 @@ static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
     return err;
 }
 
+static int inflatePrefix(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+{
+    z_stream stream;
+    int err;
+
+    stream.next_in = const_cast<Bytef*>(source);
+    stream.avail_in = (uInt)sourceLen;
+    if ((uLong)stream.avail_in != sourceLen) {
+        return Z_BUF_ERROR;
+    }
+
+    stream.next_out = dest;
+    stream.avail_out = (uInt) * destLen;
+    if ((uLong)stream.avail_out != *destLen) {
+        return Z_BUF_ERROR;
+    }
+
+    stream.zalloc = (alloc_func)0;
+    stream.zfree = (free_func)0;
+
+    err = inflateInit2(&stream, -MAX_WBITS);
+    if (err != Z_OK) {
+        return err;
+    }
+
+    // stops when the output buffer is full
+    err = inflate(&stream, Z_SYNC_FLUSH);
+    if (err != Z_OK && err != Z_STREAM_END) {
+        inflateEnd(&stream);
+        return err == Z_NEED_DICT ? Z_DATA_ERROR : err;
+    }
+    *destLen = stream.total_out;
+
+    err = inflateEnd(&stream);
+    return err;
+}
+
 static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
 {
     z_stream stream;
@@ -385,6 +422,9 @@ struct ZipContainer::Impl {
     };
 
     void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    void writeEntry(EntryType type, const std::string& fileName, const ByteArray& data, ushort compressionMethod, uint crc,
+                    uint uncompressedSize);
+    int findFileHeader(const std::string& fileName) const;
     bool writeToDevice(const uint8_t* data, size_t len);
     bool writeToDevice(const ByteArray& data);
 
@@ -549,12 +589,6 @@ ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(int index) const
 
 void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents)
 {
-    if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
-        status = ZipContainer::FileOpenError;
-        return;
-    }
-    device->seek(start_of_directory);
-
     // don't compress small files
     ZipContainer::CompressionPolicy compression = compressionPolicy;
     if (compressionPolicy == ZipContainer::AutoCompress) {
@@ -565,19 +599,10 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         }
     }
 
-    FileHeader header;
-    std::memset(&header.h, 0, sizeof(CentralFileHeader));
-    writeUInt(header.h.signature, 0x02014b50);
-
-    writeUShort(header.h.version_needed, ZIP_VERSION);
-    writeUInt(header.h.uncompressed_size, (uint)contents.size());
-
-    std::time_t t = std::time(0);   // get time now
-    std::tm* now = std::localtime(&t);
-    writeMSDosDate(header.h.last_mod_file, *now);
+    ushort compressionMethod = CompressionMethodStored;
     ByteArray data = contents;
     if (compression == ZipContainer::AlwaysCompress) {
-        writeUShort(header.h.compression_method, CompressionMethodDeflated);
+        compressionMethod = CompressionMethodDeflated;
 
         ulong len = (ulong)contents.size();
         // shamelessly copied form zlib
@@ -602,10 +627,34 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         } while (res == Z_BUF_ERROR);
     }
 // TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
-    writeUInt(header.h.compressed_size, (uint)data.size());
     uint crc_32 = ::crc32(0, 0, 0);
     crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
-    writeUInt(header.h.crc_32, crc_32);
+
+    writeEntry(type, fileName, data, compressionMethod, crc_32, (uint)contents.size());
+}
+
+void ZipContainer::Impl::writeEntry(EntryType type, const std::string& fileName, const ByteArray& data, ushort compressionMethod,
+                                    uint crc, uint uncompressedSize)
+{
+    if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
+        status = ZipContainer::FileOpenError;
+        return;
+    }
+    device->seek(start_of_directory);
+
+    FileHeader header;
+    std::memset(&header.h, 0, sizeof(CentralFileHeader));
+    writeUInt(header.h.signature, 0x02014b50);
+
+    writeUShort(header.h.version_needed, ZIP_VERSION);
+    writeUInt(header.h.uncompressed_size, uncompressedSize);
+
+    std::time_t t = std::time(0);   // get time now
+    std::tm* now = std::localtime(&t);
+    writeMSDosDate(header.h.last_mod_file, *now);
+    writeUShort(header.h.compression_method, compressionMethod);
+    writeUInt(header.h.compressed_size, (uint)data.size());
+    writeUInt(header.h.crc_32, crc);
 
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
     ushort general_purpose_bits = Utf8Names; // always use utf-8
@@ -666,6 +715,17 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     }
 }
 
+int ZipContainer::Impl::findFileHeader(const std::string& fileName) const
+{
+    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
+    for (size_t i = 0; i < fileHeaders.size(); ++i) {
+        if (fileHeaders.at(i).file_name == fileNameBa) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
 bool ZipContainer::Impl::writeToDevice(const uint8_t* data, size_t len)
 {
     return device->write(data, len) == len;
@@ -709,29 +769,15 @@ int ZipContainer::count() const
 bool ZipContainer::fileExists(const std::string& fileName) const
 {
     p->scanFiles();
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-    for (size_t i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            return true;
-        }
-    }
-    return false;
+    return p->findFileHeader(fileName) != -1;
 }
 
 ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
     p->scanFiles();
 
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-
-    size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    int i = p->findFileHeader(fileName);
+    if (i == -1) {
         return ByteArray();
     }
 
@@ -761,22 +807,28 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
-    if (compression_method == CompressionMethodStored) {
-        // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
-    } else if (compression_method == CompressionMethodDeflated) {
+    //! NOTE The devices are memory based (e.g. mapped file), so the compressed data is not copied
+    size_t available = p->device->size() - p->device->pos();
+    ByteArray compressed = ByteArray::fromRawData(p->device->readData() + p->device->pos(),
+                                                  std::min(static_cast<size_t>(compressed_size), available));
+
+    return uncompress(compressed, compression_method, uncompressed_size);
+}
+
+ByteArray ZipContainer::uncompress(const ByteArray& data, uint16_t compressionMethod, uint32_t uncompressedSize)
+{
+    if (compressionMethod == CompressionMethodStored) {
+        // no compression, the data is copied, because it may refer to the device
+        return ByteArray(data.constData(), std::min(data.size(), static_cast<size_t>(uncompressedSize)));
+    } else if (compressionMethod == CompressionMethodDeflated) {
         // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
         ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
+        ulong len = std::max<ulong>(uncompressedSize, 1);
         int res;
         do {
             baunzip.resize(len);
             res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
+                          (const uint8_t*)data.constData(), static_cast<ulong>(data.size()));
 
             switch (res) {
             case Z_OK:
@@ -798,10 +850,79 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
         return baunzip;
     }
 
-    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compression_method);
+    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compressionMethod);
     return ByteArray();
 }
 
+ByteArray ZipContainer::uncompressPrefix(const ByteArray& data, uint16_t compressionMethod, uint32_t uncompressedSize, size_t maxSize)
+{
+    const size_t prefixSize = std::min(static_cast<size_t>(uncompressedSize), maxSize);
+
+    if (compressionMethod == CompressionMethodStored) {
+        return ByteArray(data.constData(), std::min(data.size(), prefixSize));
+    } else if (compressionMethod == CompressionMethodDeflated) {
+        ByteArray baunzip;
+        ulong len = std::max<ulong>(prefixSize, 1);
+        baunzip.resize(len);
+
+        int res = inflatePrefix((uint8_t*)baunzip.data(), &len,
+                                (const uint8_t*)data.constData(), static_cast<ulong>(data.size()));
+        if (res != Z_OK) {
+            LOGW("Zip: failed to uncompress the data, error: %d", res);
+            return ByteArray();
+        }
+
+        baunzip.resize(len);
+        return baunzip;
+    }
+
+    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compressionMethod);
+    return ByteArray();
+}
+
+ZipContainer::RawFileData ZipContainer::rawFileData(const std::string& fileName) const
+{
+    p->scanFiles();
+
+    RawFileData raw;
+
+    int i = p->findFileHeader(fileName);
+    if (i == -1) {
+        return raw;
+    }
+
+    const FileHeader& header = p->fileHeaders.at(i);
+
+    ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
+    if ((general_purpose_bits & Encrypted) != 0) {
+        return raw;
+    }
+
+    // entries with a data descriptor may have the sizes and crc missing in the local header,
+    // so always take them from the central directory
+    int compressed_size = readUInt(header.h.compressed_size);
+    int start = readUInt(header.h.offset_local_header);
+
+    p->device->seek(start);
+    LocalFileHeader lh;
+    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
+    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    p->device->seek(p->device->pos() + skip);
+
+    raw.data = p->device->read(compressed_size);
+    if (raw.data.size() != static_cast<size_t>(compressed_size)) {
+        LOGW("Zip: Failed to read raw data of %s", fileName.c_str());
+        return RawFileData();
+    }
+
+    raw.compressionMethod = readUShort(lh.compression_method);
+    raw.crc = readUInt(header.h.crc_32);
+    raw.uncompressedSize = readUInt(header.h.uncompressed_size);
+    raw.isValid = raw.compressionMethod == CompressionMethodStored || raw.compressionMethod == CompressionMethodDeflated;
+
+    return raw;
+}
+
 ZipContainer::Status ZipContainer::status() const
 {
     return p->status;
@@ -832,6 +953,22 @@ void ZipContainer::addDirectory(const std::string& dirName)
     p->addEntry(Impl::Directory, name, ByteArray());
 }
 
+void ZipContainer::addRawFile(const std::string& fileName, const RawFileData& data)
+{
+    IF_ASSERT_FAILED(data.isValid) {
+        return;
+    }
+
+    p->writeEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data.data, data.compressionMethod, data.crc,
+                  data.uncompressedSize);
+}
+
+uint32_t ZipContainer::checksum(const ByteArray& data)
+{
+    uint crc_32 = ::crc32(0, 0, 0);
+    return ::crc32(crc_32, (const uint8_t*)data.constData(), (uint)data.size());
+}
+
 void ZipContainer::close()
 {
     if (!(p->device->openMode() & IODevice::WriteOnly)) {
@@ -55,6 +55,16 @@ public:
         bool isValid() const { return isDir || isFile || isSymLink; }
     };
 
+    //! NOTE The file data as it is stored in the archive (possibly compressed)
+    struct RawFileData
+    {
+        ByteArray data;
+        uint16_t compressionMethod = 0;
+        uint32_t crc = 0;
+        uint32_t uncompressedSize = 0;
+        bool isValid = false;
+    };
+
     Status status() const;
 
     void close();
@@ -65,6 +75,7 @@ public:
 
     bool fileExists(const std::string& fileName) const;
     ByteArray fileData(const std::string& fileName) const;
+    RawFileData rawFileData(const std::string& fileName) const;
 
     // Write
     enum CompressionPolicy {
@@ -78,6 +89,12 @@ public:
 
     void addFile(const std::string& fileName, const ByteArray& data);
     void addDirectory(const std::string& dirName);
+    void addRawFile(const std::string& fileName, const RawFileData& data);
+
+    static uint32_t checksum(const ByteArray& data);
+    static ByteArray uncompress(const ByteArray& data, uint16_t compressionMethod, uint32_t uncompressedSize);
+    //! NOTE Uncompresses only the first maxSize bytes of the data
+    static ByteArray uncompressPrefix(const ByteArray& data, uint16_t compressionMethod, uint32_t uncompressedSize, size_t maxSize);
 
 private:
 
@@ -105,3 +105,50 @@ ByteArray ZipReader::fileData(const std::string& fileName) const
 {
     return m_impl->zip->fileData(fileName);
 }
+
+ZipReader::RawFileData ZipReader::rawFileData(const std::string& fileName) const
+{
+    ZipContainer::RawFileData zraw = m_impl->zip->rawFileData(fileName);
+
+    RawFileData raw;
+    raw.data = std::move(zraw.data);
+    raw.compressionMethod = zraw.compressionMethod;
+    raw.crc = zraw.crc;
+    raw.uncompressedSize = zraw.uncompressedSize;
+    raw.isValid = zraw.isValid;
+
+    return raw;
+}
+
+bool ZipReader::RawFileData::isSameData(const ByteArray& uncompressedData) const
+{
+    if (!isValid || uncompressedSize != uncompressedData.size()) {
+        return false;
+    }
+
+    if (crc != ZipContainer::checksum(uncompressedData)) {
+        return false;
+    }
+
+    //! NOTE The same CRC32 and size don't prove the data is the same, so the bytes are compared.
+    //! Uncompressing is still much cheaper than compressing the data again
+    return this->uncompressedData() == uncompressedData;
+}
+
+ByteArray ZipReader::RawFileData::uncompressedData() const
+{
+    if (!isValid) {
+        return ByteArray();
+    }
+
+    return ZipContainer::uncompress(data, compressionMethod, uncompressedSize);
+}
+
+ByteArray ZipReader::RawFileData::uncompressedData(size_t maxSize) const
+{
+    if (!isValid) {
+        return ByteArray();
+    }
+
+    return ZipContainer::uncompressPrefix(data, compressionMethod, uncompressedSize, maxSize);
+}
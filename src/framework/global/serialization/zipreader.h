@@ -43,6 +43,22 @@ public:
         bool isValid() const { return isDir || isFile || isSymLink; }
     };
 
+    //! NOTE The file data as it is stored in the archive (possibly compressed),
+    //! can be passed to ZipWriter to copy the file without recompression
+    struct RawFileData
+    {
+        ByteArray data;
+        uint16_t compressionMethod = 0;
+        uint32_t crc = 0;
+        uint32_t uncompressedSize = 0;
+
+        bool isValid = false;
+
+        bool isSameData(const ByteArray& uncompressedData) const;
+        ByteArray uncompressedData() const;
+        ByteArray uncompressedData(size_t maxSize) const; // only the first maxSize bytes
+    };
+
     explicit ZipReader(const io::path_t& filePath);
     explicit ZipReader(io::IODevice* device);
     ~ZipReader();
@@ -54,6 +70,7 @@ public:
     std::vector<FileInfo> fileInfoList() const;
     bool fileExists(const std::string& fileName) const;
     ByteArray fileData(const std::string& fileName) const;
+    RawFileData rawFileData(const std::string& fileName) const;
 
 private:
     struct Impl;
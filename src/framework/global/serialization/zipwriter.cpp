@@ -94,3 +94,16 @@ void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
     m_impl->zip->addFile(fileName, data);
     flush();
 }
+
+void ZipWriter::addRawFile(const std::string& fileName, const ZipReader::RawFileData& raw)
+{
+    ZipContainer::RawFileData zraw;
+    zraw.data = raw.data;
+    zraw.compressionMethod = raw.compressionMethod;
+    zraw.crc = raw.crc;
+    zraw.uncompressedSize = raw.uncompressedSize;
+    zraw.isValid = raw.isValid;
+
+    m_impl->zip->addRawFile(fileName, zraw);
+    flush();
+}
@@ -25,6 +25,8 @@
 #include "io/path.h"
 #include "io/iodevice.h"
 
+#include "zipreader.h"
+
 namespace mu {
 class ZipWriter
 {
@@ -38,6 +40,7 @@ public:
     bool hasError() const;
 
     void addFile(const std::string& fileName, const ByteArray& data);
+    void addRawFile(const std::string& fileName, const ZipReader::RawFileData& raw);
 
 private:
 
@@ -24,6 +24,7 @@
 #include <cstring>
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 
 using namespace mu;
 using namespace mu::io;
@@ -207,3 +208,38 @@ TEST_F(Global_IO_FileTests, FileTests_Exists_Append)
         EXPECT_EQ(refba, data);
     }
 }
+
+TEST_F(Global_IO_FileTests, MappedFileTests_Read)
+{
+    path_t filePath("MappedFileTests_Read.txt");
+    createFile(filePath, "Hello World!");
+
+    {
+        //! GIVEN Mapped file
+        MappedFile f(filePath);
+
+        //! DO Open file
+        EXPECT_TRUE(f.open(IODevice::ReadOnly));
+        EXPECT_TRUE(f.isMapped());
+
+        //! CHECK
+        EXPECT_EQ(f.size(), 12);
+
+        //! DO Read data from the middle
+        EXPECT_TRUE(f.seek(6));
+        ByteArray data = f.read(5);
+
+        //! CHECK
+        std::string ref = "World";
+        ByteArray refba(reinterpret_cast<const uint8_t*>(ref.c_str()), ref.size());
+        EXPECT_EQ(refba, data);
+    }
+
+    {
+        //! GIVEN Mapped file
+        MappedFile f(filePath);
+
+        //! CHECK Write is not allowed
+        EXPECT_FALSE(f.open(IODevice::WriteOnly));
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "concurrency/spscqueue.h"
+
+using namespace mu;
+
+class Global_Concurrency_SpscQueueTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_SpscQueueTests, PushPop)
+{
+    // [GIVEN] An empty queue
+    SpscQueue<int, 4> queue;
+    int item = 0;
+
+    // [THEN] Nothing to pop
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(item));
+
+    // [WHEN] Fill the queue
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_TRUE(queue.push(3));
+    EXPECT_TRUE(queue.push(4));
+
+    // [THEN] The queue is full
+    EXPECT_FALSE(queue.push(5));
+
+    // [THEN] The items are popped in order
+    for (int expected = 1; expected <= 4; ++expected) {
+        EXPECT_TRUE(queue.pop(item));
+        EXPECT_EQ(item, expected);
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(item));
+}
+
+TEST_F(Global_Concurrency_SpscQueueTests, WrapAround)
+{
+    // [GIVEN] A small queue
+    SpscQueue<int, 2> queue;
+    int item = 0;
+
+    // [WHEN] Push and pop many more items than the capacity
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(queue.push(i));
+        EXPECT_TRUE(queue.push(i + 1000));
+
+        // [THEN] The order is kept
+        EXPECT_TRUE(queue.pop(item));
+        EXPECT_EQ(item, i);
+        EXPECT_TRUE(queue.pop(item));
+        EXPECT_EQ(item, i + 1000);
+    }
+
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(Global_Concurrency_SpscQueueTests, TwoThreads)
+{
+    // [GIVEN] A queue between two threads
+    struct Record {
+        int index = 0;
+        double value = 0.0;
+    };
+
+    SpscQueue<Record, 64> queue;
+    constexpr int COUNT = 100000;
+
+    // [WHEN] The producer pushes many more records than the capacity
+    std::thread producer([&queue]() {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!queue.push({ i, i * 0.5 })) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // [THEN] The consumer receives all of them, in order and intact
+    int received = 0;
+    Record record;
+    while (received < COUNT) {
+        if (!queue.pop(record)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        EXPECT_EQ(record.index, received);
+        EXPECT_DOUBLE_EQ(record.value, received * 0.5);
+        ++received;
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(queue.empty());
+}
@@ -136,6 +136,17 @@ struct NoteEvent
         return m_expressionCtx;
     }
 
+    //! NOTE Moves the event in time, along with the articulations applied to it
+    void shiftTimestamp(const timestamp_t offset)
+    {
+        m_arrangementCtx.nominalTimestamp += offset;
+        m_arrangementCtx.actualTimestamp += offset;
+
+        for (auto& pair : m_expressionCtx.articulations) {
+            pair.second.meta.timestamp += offset;
+        }
+    }
+
     bool operator==(const NoteEvent& other) const
     {
         return m_arrangementCtx == other.m_arrangementCtx
@@ -264,6 +275,12 @@ struct RestEvent
         return m_arrangementCtx;
     }
 
+    void shiftTimestamp(const timestamp_t offset)
+    {
+        m_arrangementCtx.nominalTimestamp += offset;
+        m_arrangementCtx.actualTimestamp += offset;
+    }
+
     bool operator==(const RestEvent& other) const
     {
         return m_arrangementCtx == other.m_arrangementCtx;
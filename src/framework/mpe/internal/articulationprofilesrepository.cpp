@@ -72,6 +72,9 @@ ArticulationsProfilePtr ArticulationProfilesRepository::createNew() const
 
 ArticulationsProfilePtr ArticulationProfilesRepository::defaultProfile(const ArticulationFamily family) const
 {
+    //! NOTE The playback events of the parts may be rendered concurrently
+    std::lock_guard lock(m_defaultProfilesMutex);
+
     auto search = m_defaultProfiles.find(family);
 
     if (search != m_defaultProfiles.cend()) {
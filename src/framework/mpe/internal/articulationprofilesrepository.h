@@ -23,6 +23,8 @@
 #ifndef MU_MPE_ARTICULATIONPROFILESREPOSITORY_H
 #define MU_MPE_ARTICULATIONPROFILESREPOSITORY_H
 
+#include <mutex>
+
 #include "modularity/ioc.h"
 #include "io/ifilesystem.h"
 #include "async/asyncable.h"
@@ -60,6 +62,7 @@ private:
     QJsonObject expressionPatternToJson(const ExpressionPattern& pattern) const;
 
     mutable std::unordered_map<ArticulationFamily, ArticulationsProfilePtr> m_defaultProfiles;
+    mutable std::mutex m_defaultProfilesMutex;
 
     async::Channel<io::path_t> m_profileChanged;
 };
@@ -21,7 +21,10 @@
  */
 #include "vstsynthesiser.h"
 
+#include <algorithm>
+
 #include "log.h"
+#include "audio/audioutils.h"
 
 #include "internal/vstplugin.h"
 
@@ -152,6 +155,7 @@ audio::msecs_t VstSynthesiser::playbackPosition() const
 void VstSynthesiser::setPlaybackPosition(const audio::msecs_t newPosition)
 {
     m_sequencer.setPlaybackPosition(newPosition);
+    m_renderedSamples = 0;
 
     if (isActive()) {
         m_vstAudioClient->setVolumeGain(m_sequencer.currentGain());
@@ -161,6 +165,7 @@ void VstSynthesiser::setPlaybackPosition(const audio::msecs_t newPosition)
 void VstSynthesiser::setSampleRate(unsigned int sampleRate)
 {
     m_sampleRate = sampleRate;
+    m_renderedSamples = 0;
     m_vstAudioClient->setSampleRate(sampleRate);
 }
 
@@ -180,18 +185,38 @@ audio::samples_t VstSynthesiser::process(float* buffer, audio::samples_t samples
         return 0;
     }
 
-    audio::msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
-    VstSequencer::EventSequence sequence = m_sequencer.eventsToBePlayed(nextMsecs);
-
-    for (const VstSequencer::EventType& event : sequence) {
-        if (std::holds_alternative<VstEvent>(event)) {
-            m_vstAudioClient->handleEvent(std::get<VstEvent>(event));
-        } else if (std::holds_alternative<PluginParamInfo>(event)) {
-            m_vstAudioClient->handleParamChange(std::get<PluginParamInfo>(event));
-        } else {
-            audio::gain_t newGain = std::get<audio::gain_t>(event);
-            m_vstAudioClient->setVolumeGain(newGain);
+    const bool active = isActive();
+    const audio::SynthBlock block = audio::synthBlock(m_renderedSamples, samplesPerChannel, m_sampleRate);
+    const audio::msecs_t nextMsecs = active ? block.durationMsecs : samplesToMsecs(samplesPerChannel, m_sampleRate);
+
+    VstSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayed(nextMsecs);
+
+    for (const auto& pair : sequences) {
+        //! NOTE The plugin places the events in the block by their sample offset
+        audio::samples_t offset = 0;
+
+        if (active) {
+            offset = audio::synthEventOffset(block, pair.first);
         }
+
+        const int32_t sampleOffset = static_cast<int32_t>(std::min(offset, samplesPerChannel - 1));
+
+        for (const VstSequencer::EventType& event : pair.second) {
+            if (std::holds_alternative<VstEvent>(event)) {
+                VstEvent vstEvent = std::get<VstEvent>(event);
+                vstEvent.sampleOffset = sampleOffset;
+                m_vstAudioClient->handleEvent(vstEvent);
+            } else if (std::holds_alternative<PluginParamInfo>(event)) {
+                m_vstAudioClient->handleParamChange(std::get<PluginParamInfo>(event));
+            } else {
+                audio::gain_t newGain = std::get<audio::gain_t>(event);
+                m_vstAudioClient->setVolumeGain(newGain);
+            }
+        }
+    }
+
+    if (active) {
+        m_renderedSamples += samplesPerChannel;
     }
 
     return m_vstAudioClient->process(buffer, samplesPerChannel);
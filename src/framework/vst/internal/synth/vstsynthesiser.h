@@ -82,6 +82,7 @@ private:
     audio::samples_t m_samplesPerChannel = 0;
 
     VstSequencer m_sequencer;
+    audio::samples_t m_renderedSamples = 0; // since the last position change
 };
 
 using VstSynthPtr = std::shared_ptr<VstSynthesiser>;
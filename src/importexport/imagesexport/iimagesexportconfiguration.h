@@ -51,6 +51,13 @@ public:
 
     virtual int trimMarginPixelSize() const = 0;
     virtual void setTrimMarginPixelSize(std::optional<int> pixelSize) = 0;
+
+    // Svg
+    virtual bool exportSvgReuseSymbols() const = 0;
+    virtual void setExportSvgReuseSymbols(bool reuse) = 0;
+
+    //! NOTE Maybe set from command line
+    virtual void setExportSvgReuseSymbolsOverride(std::optional<bool> reuse) = 0;
 };
 }
 
@@ -31,12 +31,14 @@ using namespace mu::iex::imagesexport;
 static const Settings::Key EXPORT_PDF_DPI_RESOLUTION_KEY("iex_imagesexport", "export/pdf/dpi");
 static const Settings::Key EXPORT_PNG_DPI_RESOLUTION_KEY("iex_imagesexport", "export/png/resolution");
 static const Settings::Key EXPORT_PNG_USE_TRANSPARENCY_KEY("iex_imagesexport", "export/png/useTransparency");
+static const Settings::Key EXPORT_SVG_REUSE_SYMBOLS_KEY("iex_imagesexport", "export/svg/reuseSymbols");
 
 void ImagesExportConfiguration::init()
 {
     settings()->setDefaultValue(EXPORT_PNG_DPI_RESOLUTION_KEY, Val(mu::engraving::DPI));
     settings()->setDefaultValue(EXPORT_PDF_DPI_RESOLUTION_KEY, Val(mu::engraving::DPI));
     settings()->setDefaultValue(EXPORT_PNG_USE_TRANSPARENCY_KEY, Val(false));
+    settings()->setDefaultValue(EXPORT_SVG_REUSE_SYMBOLS_KEY, Val(false));
 }
 
 int ImagesExportConfiguration::exportPdfDpiResolution() const
@@ -87,3 +89,22 @@ void ImagesExportConfiguration::setTrimMarginPixelSize(std::optional<int> pixelS
 {
     m_trimMarginPixelSize = pixelSize;
 }
+
+bool ImagesExportConfiguration::exportSvgReuseSymbols() const
+{
+    if (m_customExportSvgReuseSymbolsOverride) {
+        return m_customExportSvgReuseSymbolsOverride.value();
+    }
+
+    return settings()->value(EXPORT_SVG_REUSE_SYMBOLS_KEY).toBool();
+}
+
+void ImagesExportConfiguration::setExportSvgReuseSymbols(bool reuse)
+{
+    settings()->setSharedValue(EXPORT_SVG_REUSE_SYMBOLS_KEY, Val(reuse));
+}
+
+void ImagesExportConfiguration::setExportSvgReuseSymbolsOverride(std::optional<bool> reuse)
+{
+    m_customExportSvgReuseSymbolsOverride = reuse;
+}
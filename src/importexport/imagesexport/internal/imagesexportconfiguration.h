@@ -43,9 +43,14 @@ public:
     int trimMarginPixelSize() const override;
     void setTrimMarginPixelSize(std::optional<int> pixelSize) override;
 
+    bool exportSvgReuseSymbols() const override;
+    void setExportSvgReuseSymbols(bool reuse) override;
+    void setExportSvgReuseSymbolsOverride(std::optional<bool> reuse) override;
+
 private:
     std::optional<int> m_trimMarginPixelSize;
     std::optional<float> m_customExportPngDpiOverride;
+    std::optional<bool> m_customExportSvgReuseSymbolsOverride;
 };
 }
 
@@ -22,8 +22,15 @@
 
 #include "pdfwriter.h"
 
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <thread>
+
 #include <QPdfWriter>
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
 #include "engraving/dom/masterscore.h"
 
 #include "log.h"
@@ -59,15 +66,11 @@ mu::Ret PdfWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return false;
     }
 
-    INotationPainting::Options opt;
-    opt.deviceDpi = pdfWriter.logicalDpiX();
-    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
-
-    notation->painting()->paintPdf(&painter, opt);
+    Ret ret = writePages({ notation }, pdfWriter, painter);
 
     painter.endDraw();
 
-    return true;
+    return ret;
 }
 
 mu::Ret PdfWriter::writeList(const INotationPtrList& notations, QIODevice& destinationDevice, const Options& options)
@@ -89,32 +92,95 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, QIODevice& desti
     QPdfWriter pdfWriter(&destinationDevice);
     preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
 
+    for (auto notation : notations) {
+        IF_ASSERT_FAILED(notation) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+
     Painter painter(&pdfWriter, "pdfwriter");
     if (!painter.isActive()) {
         return false;
     }
 
-    INotationPainting::Options opt;
-    opt.deviceDpi = pdfWriter.logicalDpiX();
-    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
+    Ret ret = writePages(notations, pdfWriter, painter);
 
-    for (auto notation : notations) {
-        IF_ASSERT_FAILED(notation) {
-            return make_ret(Ret::Code::UnknownError);
+    painter.endDraw();
+
+    return ret;
+}
+
+//! NOTE The pages are painted into draw data on worker threads (the page painting is reentrant)
+//! and replayed into the pdf in order, as soon as they are ready.
+//! The draw data keeps all that a page paints: the clip, the SVG images (painted into the pdf on replay) and so on.
+//! QPdfWriter writes the content of a page out when the next page begins,
+//! so the document is streamed to the device while the following pages are still being painted.
+//! The fonts are embedded by QPdfWriter once per document, also for a multi-part pdf.
+//! The number of painted pages waiting to be written is bounded, to bound the memory
+Ret PdfWriter::writePages(const INotationPtrList& notations, QPdfWriter& pdfWriter, Painter& painter) const
+{
+    struct PageTask {
+        INotationPtr notation;
+        int pageIndex = 0;
+        std::future<DrawDataPtr> data;
+    };
+
+    const int deviceDpi = pdfWriter.logicalDpiX();
+
+    std::vector<PageTask> tasks;
+    for (const INotationPtr& notation : notations) {
+        //! NOTE Also prepares the painting on this thread, before the workers use it
+        notation->painting()->pageSizeInch();
+
+        const size_t pageCount = notation->elements()->msScore()->pages().size();
+        for (size_t i = 0; i < pageCount; ++i) {
+            tasks.push_back({ notation, static_cast<int>(i), std::future<DrawDataPtr>() });
         }
+    }
+
+    auto paintPage = [deviceDpi](INotationPtr notation, int pageIndex) {
+        auto recorder = std::make_shared<BufferedPaintProvider>();
+        Painter painter(recorder, "pdfwriter_page_" + std::to_string(pageIndex));
+
+        INotationPainting::Options opt;
+        opt.deviceDpi = deviceDpi;
+        opt.fromPage = pageIndex;
+        opt.toPage = pageIndex;
+
+        notation->painting()->paintPdf(&painter, opt);
+        painter.endDraw();
+
+        return recorder->drawData();
+    };
+
+    const size_t maxPendingPages = std::max(1u, std::thread::hardware_concurrency());
+    size_t nextTask = 0;
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        for (; nextTask < tasks.size() && nextTask < i + maxPendingPages; ++nextTask) {
+            PageTask& task = tasks[nextTask];
+            task.data = std::async(std::launch::async, paintPage, task.notation, task.pageIndex);
+        }
+
+        PageTask& task = tasks[i];
+        DrawDataPtr data = task.data.get();
 
-        if (notation != firstNotation) {
-            QSizeF size = notation->painting()->pageSizeInch().toQSizeF();
-            pdfWriter.setPageSize(QPageSize(size, QPageSize::Inch));
+        if (i > 0) {
+            if (task.notation != tasks[i - 1].notation) {
+                QSizeF size = task.notation->painting()->pageSizeInch().toQSizeF();
+                pdfWriter.setPageSize(QPageSize(size, QPageSize::Inch));
+            }
             pdfWriter.newPage();
         }
 
-        notation->painting()->paintPdf(&painter, opt);
-    }
+        IF_ASSERT_FAILED(data) {
+            return make_ret(Ret::Code::UnknownError);
+        }
 
-    painter.endDraw();
+        DrawDataPaint::paint(&painter, data);
+    }
 
-    return true;
+    return make_ret(Ret::Code::Ok);
 }
 
 void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const
@@ -30,6 +30,10 @@
 
 class QPdfWriter;
 
+namespace mu::draw {
+class Painter;
+}
+
 namespace mu::iex::imagesexport {
 class PdfWriter : public AbstractImageWriter
 {
@@ -42,6 +46,7 @@ public:
 
 private:
     void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
+    Ret writePages(const notation::INotationPtrList& notations, QPdfWriter& pdfWriter, draw::Painter& painter) const;
 };
 }
 
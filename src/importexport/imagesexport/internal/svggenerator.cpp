@@ -21,7 +21,9 @@
  */
 
 #include <QTextStream>
+#include <QTextItem>
 #include <QBuffer>
+#include <QHash>
 #include <QFile>
 #include <QTextCodec>
 #include <QPainterPath>
@@ -174,9 +176,13 @@ public:
     int resolution;
 
     QString header;
-//    QString defs; // NEEDED FOR GRADIENTS
+    QString defs;
     QString body;
 
+    // symbol outlines written to <defs>, by font and glyph
+    bool reuseSymbols = false;
+    QHash<QString, QString> symbolIds;
+
     QBrush brush;
     QPen pen;
     QTransform transform;
@@ -236,6 +242,8 @@ protected:
     const mu::engraving::EngravingItem* _element = NULL;
 
     void writeImage(const QRectF& r, const QByteArray& imageData, const QString& mimeFormat);
+    void writePathData(QTextStream& str, const QPainterPath& p, qreal dx, qreal dy) const;
+    QString symbolId(const QFont& font, const QString& text);
 
 // SVG strings as constants
 #define SVG_SPACE    ' '
@@ -270,6 +278,8 @@ protected:
 #define SVG_CURVE    'C'
 
 #define SVG_CLASS    " class=\""
+#define SVG_ID       " id=\""
+#define SVG_HREF     " xlink:href=\"#"
 
 #define SVG_ELEMENT_END  "/>"
 #define SVG_RPAREN_QUOTE ")\""
@@ -278,9 +288,12 @@ protected:
 #define SVG_TITLE_END   "</title>"
 #define SVG_DESC_BEGIN  "<desc>"
 #define SVG_DESC_END    "</desc>"
+#define SVG_DEFS_BEGIN  "<defs>"
+#define SVG_DEFS_END    "</defs>"
 
 #define SVG_IMAGE       "<image"
 #define SVG_PATH        "<path"
+#define SVG_USE         "<use"
 #define SVG_POLYLINE    "<polyline"
 
 #define SVG_PRESERVE_ASPECT " preserveAspectRatio=\""
@@ -321,6 +334,7 @@ public:
     void popGroup();
 
     void drawPath(const QPainterPath& path);
+    void drawTextItem(const QPointF& p, const QTextItem& textItem);
     void drawPixmap(const QRectF& r, const QPixmap& pm, const QRectF& sr);
     void drawPolygon(const QPoint* points, int pointCount, PolygonDrawMode mode) { QPaintEngine::drawPolygon(points, pointCount, mode); }
     void drawPolygon(const QPointF* points, int pointCount, PolygonDrawMode mode);
@@ -368,6 +382,13 @@ public:
         d_func()->resolution = resolution;
     }
 
+    bool reuseSymbols() const { return d_func()->reuseSymbols; }
+    void setReuseSymbols(bool reuse)
+    {
+        Q_ASSERT(!isActive());
+        d_func()->reuseSymbols = reuse;
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 // UNUSED GRADIENT CODE:
 //    void saveLinearGradientBrush(const QGradient *g)
@@ -952,6 +973,31 @@ void SvgGenerator::setResolution(int dpi)
     d->engine->setResolution(dpi);
 }
 
+/*!
+    \property SvgGenerator::reuseSymbols
+    \brief whether each distinct symbol is written once
+
+    When enabled, the outline of every distinct glyph drawn as a single character
+    (the SMuFL symbols, mostly) is written once to \c{<defs>} and each occurrence
+    is a \c{<use>} reference to it, instead of a full \c{<path>}.
+    Disabled by default.
+*/
+bool SvgGenerator::reuseSymbols() const
+{
+    Q_D(const SvgGenerator);
+    return d->engine->reuseSymbols();
+}
+
+void SvgGenerator::setReuseSymbols(bool reuse)
+{
+    Q_D(SvgGenerator);
+    if (d->engine->isActive()) {
+        LOGW("SvgGenerator::setReuseSymbols(), cannot set reuseSymbols while SVG is being generated");
+        return;
+    }
+    d->engine->setReuseSymbols(reuse);
+}
+
 /*!
     Returns the paint engine used to render graphics to be converted to SVG
     format information.
@@ -1057,9 +1103,8 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
+    d->defs.clear();
+    d->symbolIds.clear();
 
     // Point the stream at the body string, for other functions to populate
     d->stream->setString(&d->body);
@@ -1070,10 +1115,6 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
-
     // Point the stream at the real output device (the .svg file)
     d->stream->setDevice(d->outputDevice);
 
@@ -1083,7 +1124,9 @@ bool SvgPaintEngine::end()
 
     // Stream our strings out to the device, in order
     stream() << d->header;
-//    stream() << d->defs;
+    if (!d->defs.isEmpty()) {
+        stream() << SVG_DEFS_BEGIN << Qt::endl << d->defs << SVG_DEFS_END << Qt::endl;
+    }
     stream() << d->body;
     stream() << SVG_END << Qt::endl;
 
@@ -1213,25 +1256,31 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
 
     // Path data
     stream() << SVG_D;
+    writePathData(stream(), p, _dx, _dy);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+}
+
+void SvgPaintEngine::writePathData(QTextStream& str, const QPainterPath& p, qreal dx, qreal dy) const
+{
     for (int i = 0; i < p.elementCount(); ++i) {
         const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
+        qreal x = e.x + dx;
+        qreal y = e.y + dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
-            stream() << SVG_MOVE << x << SVG_COMMA << y;
+            str << SVG_MOVE << x << SVG_COMMA << y;
             break;
         case QPainterPath::LineToElement:
-            stream() << SVG_LINE << x << SVG_COMMA << y;
+            str << SVG_LINE << x << SVG_COMMA << y;
             break;
         case QPainterPath::CurveToElement:
-            stream() << SVG_CURVE << x << SVG_COMMA << y;
+            str << SVG_CURVE << x << SVG_COMMA << y;
             ++i;
             while (i < p.elementCount()) {
                 const QPainterPath::Element& ee = p.elementAt(i);
                 if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
+                    str << SVG_SPACE << ee.x + dx
+                        << SVG_COMMA << ee.y + dy;
                     ++i;
                 } else {
                     --i;
@@ -1243,10 +1292,72 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
             break;
         }
         if (i <= p.elementCount() - 1) {
-            stream() << SVG_SPACE;
+            str << SVG_SPACE;
         }
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+}
+
+void SvgPaintEngine::drawTextItem(const QPointF& p, const QTextItem& textItem)
+{
+    Q_D(SvgPaintEngine);
+
+    // Only single characters are worth sharing: the symbols drawn by Painter::drawSymbol
+    const QString text = textItem.text();
+    const bool isSingleChar = text.size() == 1 || (text.size() == 2 && text.at(0).isHighSurrogate());
+    if (!d->reuseSymbols || !isSingleChar) {
+        QPaintEngine::drawTextItem(p, textItem);
+        return;
+    }
+
+    const QString id = symbolId(textItem.font(), text);
+    if (id.isEmpty()) {
+        return;
+    }
+
+    // Same state as the path QPaintEngine::drawTextItem() would fill
+    painter()->save();
+    painter()->translate(p);
+    painter()->setBrush(painter()->pen().brush());
+    painter()->setPen(Qt::NoPen);
+    updateState(*this->state);
+
+    stream() << SVG_USE << stateString << SVG_HREF << id << SVG_QUOTE;
+    if (_dx != 0 || _dy != 0) {
+        stream() << SVG_X << SVG_QUOTE << _dx << SVG_QUOTE
+                 << SVG_Y << SVG_QUOTE << _dy << SVG_QUOTE;
+    }
+    stream() << SVG_ELEMENT_END << Qt::endl;
+
+    painter()->restore();
+}
+
+QString SvgPaintEngine::symbolId(const QFont& font, const QString& text)
+{
+    Q_D(SvgPaintEngine);
+
+    const QString key = font.key() + QLatin1Char('/') + text;
+    auto it = d->symbolIds.constFind(key);
+    if (it != d->symbolIds.cend()) {
+        return it.value();
+    }
+
+    QPainterPath path;
+    path.addText(QPointF(0, 0), font, text);
+    if (path.isEmpty()) {
+        d->symbolIds.insert(key, QString());
+        return QString();
+    }
+
+    const QString id = QString::fromLatin1("s%1").arg(d->symbolIds.size());
+    d->symbolIds.insert(key, id);
+
+    // The outline stays at the origin, each <use> places it
+    QTextStream str(&d->defs);
+    str << SVG_PATH << SVG_ID << id << SVG_QUOTE << SVG_D;
+    writePathData(str, path, 0, 0);
+    str << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+
+    return id;
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
@@ -45,6 +45,7 @@ class SvgGeneratorPrivate;
 //   @P fileName      QString
 //   @P outputDevice  QIODevice
 //   @P resolution    int
+//   @P reuseSymbols  bool
 //---------------------------------------------------------
 
 class SvgGenerator : public QPaintDevice
@@ -58,6 +59,7 @@ class SvgGenerator : public QPaintDevice
     Q_PROPERTY(QString fileName READ fileName WRITE setFileName)
     Q_PROPERTY(QIODevice * outputDevice READ outputDevice WRITE setOutputDevice)
     Q_PROPERTY(int resolution READ resolution WRITE setResolution)
+    Q_PROPERTY(bool reuseSymbols READ reuseSymbols WRITE setReuseSymbols)
 public:
     SvgGenerator();
     ~SvgGenerator();
@@ -85,6 +87,9 @@ public:
     void setResolution(int dpi);
     int resolution() const;
 
+    bool reuseSymbols() const;
+    void setReuseSymbols(bool reuse);
+
     void setElement(const mu::engraving::EngravingItem* e);
 
 protected:
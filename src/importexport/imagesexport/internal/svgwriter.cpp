@@ -59,13 +59,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
-    score->setPrinting(true); // don’t print page break symbols etc.
-
-    mu::engraving::MScore::pdfPrinting = true;
-    mu::engraving::MScore::svgPrinting = true;
-
     const std::vector<mu::engraving::Page*>& pages = score->pages();
-    double pixelRationBackup = mu::engraving::MScore::pixelRatio;
 
     const size_t PAGE_NUMBER = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
     if (PAGE_NUMBER >= pages.size()) {
@@ -78,6 +72,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     QString title(score->name());
     printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
     printer.setOutputDevice(&destinationDevice);
+    printer.setReuseSymbols(configuration()->exportSvgReuseSymbols());
 
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
@@ -93,11 +88,13 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
 
     mu::draw::Painter painter(&printer, "svgwriter");
     painter.setAntialiasing(true);
+    painter.setIsPrinting(true); // don’t print page break symbols etc.
+    painter.setIsSvgPrinting(true);
     if (TRIM_MARGIN_SIZE >= 0) {
         painter.translate(-pageRect.topLeft());
     }
 
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / printer.logicalDpiX();
+    painter.setPixelRatio(mu::engraving::DPI / printer.logicalDpiX());
 
     if (!options[OptionKey::TRANSPARENT_BACKGROUND].toBool()) {
         painter.fillRect(pageRect, mu::draw::Color::WHITE);
@@ -185,12 +182,16 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                             continue;
                         }
 
+                        // only write changed colors, so that further pages can be painted concurrently
+                        const mu::draw::Color beatColor = mu::draw::Color::fromQColor(beatsColors[beatIndex]);
                         if (element->isChord()) {
                             for (Note* note : toChord(element)->notes()) {
-                                note->setColor(beatsColors[beatIndex]);
+                                if (note->color() != beatColor) {
+                                    note->setColor(beatColor);
+                                }
                             }
-                        } else if (element->isChordRest()) {
-                            element->setColor(beatsColors[beatIndex]);
+                        } else if (element->isChordRest() && element->color() != beatColor) {
+                            element->setColor(beatColor);
                         }
                     }
                 }
@@ -228,12 +229,6 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
 
     painter.endDraw(); // Writes MuseScore SVG file to disk, finally
 
-    // Clean up and return
-    mu::engraving::MScore::pixelRatio = pixelRationBackup;
-    score->setPrinting(false);
-    mu::engraving::MScore::pdfPrinting = false;
-    mu::engraving::MScore::svgPrinting = false;
-
     return true;
 }
 
@@ -22,6 +22,8 @@
 #ifndef MU_IMPORTEXPORT_IMUSICXMLCONFIGURATION_H
 #define MU_IMPORTEXPORT_IMUSICXMLCONFIGURATION_H
 
+#include <optional>
+
 #include "modularity/imoduleinterface.h"
 #include "io/path.h"
 
@@ -57,6 +59,10 @@ public:
 
     virtual bool needAskAboutApplyingNewStyle() const = 0;
     virtual void setNeedAskAboutApplyingNewStyle(bool value) = 0;
+
+    //! NOTE Not persisted, only overridden for the current session (e.g. from the command line)
+    virtual bool musicxmlImportValidation() const = 0;
+    virtual void setMusicxmlImportValidationOverride(std::optional<bool> value) = 0;
 };
 }
 
@@ -85,7 +85,7 @@ static void updateNamesForAccidentals(Instrument* inst)
 //   importMusicXMLfromBuffer
 //---------------------------------------------------------
 
-Err importMusicXMLfromBuffer(Score* score, const QString& /*name*/, QIODevice* dev)
+Err importMusicXMLfromBuffer(Score* score, const QString& /*name*/, QIODevice* dev, const std::function<Err()>& validationResult)
 {
     //LOGD("importMusicXMLfromBuffer(score %p, name '%s', dev %p)",
     //       score, qPrintable(name), dev);
@@ -95,17 +95,28 @@ Err importMusicXMLfromBuffer(Score* score, const QString& /*name*/, QIODevice* d
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_TRACE); // also include tracing
 
-    // pass 1
+    // tokenize the document once, both passes replay the same token stream
     dev->seek(0);
+    const MxmlTokenStreamPtr tokens = MxmlTokenStream::read(dev);
+
+    // pass 1
     MusicXMLParserPass1 pass1(score, &logger);
-    Err res = pass1.parse(dev);
+    Err res = pass1.parse(tokens);
     const auto pass1_errors = pass1.errors();
 
+    // the schema validation runs concurrently with pass 1, its result is needed
+    // before pass 2 modifies the score and any parse errors are reported
+    if (validationResult) {
+        const Err validationRes = validationResult();
+        if (validationRes != Err::NoError) {
+            return validationRes;
+        }
+    }
+
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
     if (res == Err::NoError) {
-        dev->seek(0);
-        res = pass2.parse(dev);
+        res = pass2.parse(tokens);
     }
 
     for (const Part* part : score->parts()) {
@@ -23,6 +23,8 @@
 #ifndef __IMPORTMXML_H__
 #define __IMPORTMXML_H__
 
+#include <functional>
+
 #include "engravingerrors.h"
 
 class QString;
@@ -31,7 +33,9 @@ class QIODevice;
 namespace mu::engraving {
 class Score;
 
-Err importMusicXMLfromBuffer(Score* score, const QString&, QIODevice* dev);
+//! NOTE If set, validationResult is waited for once pass 1 has finished, before anything is reported to the user;
+//! a result other than Err::NoError aborts the import
+Err importMusicXMLfromBuffer(Score* score, const QString&, QIODevice* dev, const std::function<Err()>& validationResult = nullptr);
 }
 
 #endif
@@ -25,9 +25,9 @@
 
 #include <QString>
 
-class QXmlStreamReader;
-
 namespace mu::engraving {
+class MxmlStreamReader;
+
 class MxmlLogger
 {
 public:
@@ -35,9 +35,9 @@ public:
         MXML_TRACE, MXML_INFO, MXML_ERROR
     };
     MxmlLogger() {}
-    void logDebugTrace(const QString& trace, const QXmlStreamReader* const xmlreader = 0);
-    void logDebugInfo(const QString& info, const QXmlStreamReader* const xmlreader = 0);
-    void logError(const QString& error, const QXmlStreamReader* const xmlreader = 0);
+    void logDebugTrace(const QString& trace, const MxmlStreamReader* const xmlreader = 0);
+    void logDebugInfo(const QString& info, const MxmlStreamReader* const xmlreader = 0);
+    void logError(const QString& error, const MxmlStreamReader* const xmlreader = 0);
     void setLoggingLevel(const Level level) { _level = level; }
 private:
     Level _level = Level::MXML_INFO;
@@ -20,13 +20,12 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <QXmlStreamReader>
-
 #include "engraving/types/fraction.h"
 #include "engraving/types/typesconv.h"
 
 #include "importmxmllogger.h"
 #include "importmxmlnoteduration.h"
+#include "importmxmlstreamreader.h"
 
 using namespace mu::engraving;
 
@@ -197,7 +196,7 @@ QString mxmlNoteDuration::checkTiming(const QString& type, const bool rest, cons
  Parse the /score-partwise/part/measure/note/duration node.
  */
 
-void mxmlNoteDuration::duration(QXmlStreamReader& e)
+void mxmlNoteDuration::duration(MxmlStreamReader& e)
 {
     _logger->logDebugTrace("MusicXMLParserPass1::duration", &e);
 
@@ -225,7 +224,7 @@ void mxmlNoteDuration::duration(QXmlStreamReader& e)
  Return true if handled.
  */
 
-bool mxmlNoteDuration::readProperties(QXmlStreamReader& e)
+bool mxmlNoteDuration::readProperties(MxmlStreamReader& e)
 {
     const QStringRef& tag(e.name());
     //LOGD("tag %s", qPrintable(tag.toString()));
@@ -251,7 +250,7 @@ bool mxmlNoteDuration::readProperties(QXmlStreamReader& e)
  Parse the /score-partwise/part/measure/note/time-modification node.
  */
 
-void mxmlNoteDuration::timeModification(QXmlStreamReader& e)
+void mxmlNoteDuration::timeModification(MxmlStreamReader& e)
 {
     _logger->logDebugTrace("MusicXMLParserPass1::timeModification", &e);
 
@@ -946,14 +946,14 @@ static void fixupSigmap(MxmlLogger* logger, Score* score, const QVector<Fraction
 //---------------------------------------------------------
 
 /**
- Parse MusicXML in \a device and extract pass 1 data.
+ Parse the tokenized MusicXML in \a stream and extract pass 1 data.
  */
 
-Err MusicXMLParserPass1::parse(QIODevice* device)
+Err MusicXMLParserPass1::parse(const MxmlTokenStreamPtr& stream)
 {
     _logger->logDebugTrace("MusicXMLParserPass1::parse device");
     _parts.clear();
-    _e.setDevice(device);
+    _e.setTokenStream(stream);
     auto res = parse();
     if (res != Err::NoError) {
         return res;
@@ -1270,7 +1270,7 @@ static QString decodeEntities(const QString& src)
  Read the next part of a MusicXML formatted string and convert to MuseScore internal encoding.
  */
 
-static QString nextPartOfFormattedString(QXmlStreamReader& e)
+static QString nextPartOfFormattedString(MxmlStreamReader& e)
 {
     //QString lang       = e.attribute(QString("xml:lang"), "it");
     QString fontWeight = e.attributes().value("font-weight").toString();
@@ -2405,7 +2405,7 @@ void MusicXMLParserPass1::clef(const QString& /* partId */)
 
 // TODO: share between pass 1 and pass 2
 
-static bool determineTimeSig(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static bool determineTimeSig(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                              const QString beats, const QString beatType, const QString timeSymbol,
                              TimeSigType& st, int& bts, int& btp)
 {
@@ -23,7 +23,7 @@
 #ifndef __IMPORTMXMLPASS1_H__
 #define __IMPORTMXMLPASS1_H__
 
-#include <QXmlStreamReader>
+#include "importmxmlstreamreader.h"
 
 #include "importxmlfirstpass.h"
 #include "musicxml.h" // for the creditwords and MusicXmlPartGroupList definitions
@@ -122,7 +122,7 @@ class MusicXMLParserPass1
 public:
     MusicXMLParserPass1(Score* score, MxmlLogger* logger);
     void initPartState(const QString& partId);
-    Err parse(QIODevice* device);
+    Err parse(const MxmlTokenStreamPtr& stream);
     Err parse();
     QString errors() const { return _errors; }
     void scorePartwise();
@@ -180,7 +180,7 @@ private:
     void addError(const QString& error);        ///< Add an error to be shown in the GUI
 
     // generic pass 1 data
-    QXmlStreamReader _e;
+    MxmlStreamReader _e;
     int _divs;                                  ///< Current MusicXML divisions value
     QMap<QString, MusicXmlPart> _parts;         ///< Parts data, mapped on part id
     std::set<int> _systemStartMeasureNrs;       ///< Measure numbers of measures starting a page
@@ -118,7 +118,7 @@ static std::shared_ptr<mu::engraving::IEngravingFontsProvider> engravingFonts()
 //---------------------------------------------------------
 
 static void addTie(const Notation& notation, Score* score, Note* note, const track_idx_t track, Tie*& tie, MxmlLogger* logger,
-                   const QXmlStreamReader* const xmlreader);
+                   const MxmlStreamReader* const xmlreader);
 
 //---------------------------------------------------------
 //   support enums / structs / classes
@@ -587,7 +587,7 @@ static void updatePartWithInstrumentChange(Part* const part, const MusicXMLInstr
  - MusicXMLInstruments: instrument details from score-part and part
  */
 
-static void setPartInstruments(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void setPartInstruments(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                                Part* part, const QString& partId,
                                Score* score,
                                const MusicXmlInstrList& instrList,
@@ -767,7 +767,7 @@ static QString decodeEntities(const QString& src)
  */
 
 namespace xmlpass2 {
-static QString nextPartOfFormattedString(QXmlStreamReader& e)
+static QString nextPartOfFormattedString(MxmlStreamReader& e)
 {
     //QString lang       = e.attribute(QString("xml:lang"), "it");
     QString fontWeight = e.attributes().value("font-weight").toString();
@@ -854,7 +854,7 @@ static QString nextPartOfFormattedString(QXmlStreamReader& e)
  Add a single lyric to the score or delete it (if number too high)
  */
 
-static void addLyric(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void addLyric(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                      ChordRest* cr, Lyrics* l, int lyricNo, MusicXmlLyricsExtend& extendedLyrics)
 {
     if (lyricNo > MAX_LYRICS) {
@@ -876,7 +876,7 @@ static void addLyric(MxmlLogger* logger, const QXmlStreamReader* const xmlreader
  Add a notes lyrics to the score
  */
 
-static void addLyrics(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void addLyrics(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                       ChordRest* cr,
                       const QMap<int, Lyrics*>& numbrdLyrics,
                       const QSet<Lyrics*>& extLyrics,
@@ -1589,13 +1589,13 @@ void MusicXMLParserPass2::skipLogCurrElem()
 //---------------------------------------------------------
 
 /**
- Parse MusicXML in \a device and extract pass 2 data.
+ Parse the tokenized MusicXML in \a stream and extract pass 2 data.
  */
 
-Err MusicXMLParserPass2::parse(QIODevice* device)
+Err MusicXMLParserPass2::parse(const MxmlTokenStreamPtr& stream)
 {
     //LOGD("MusicXMLParserPass2::parse()");
-    _e.setDevice(device);
+    _e.setTokenStream(stream);
     Err res = parse();
     //LOGD("MusicXMLParserPass2::parse() res %d", int(res));
     return res;
@@ -2654,7 +2654,7 @@ void MusicXMLParserPass2::measureStyle(Measure* measure)
 //   calcTicks
 //---------------------------------------------------------
 
-static Fraction calcTicks(const QString& text, int divs, MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+static Fraction calcTicks(const QString& text, int divs, MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     Fraction dura(0, 0);                // invalid unless set correctly
 
@@ -4448,7 +4448,7 @@ static void addFiguredBassElements(FiguredBassList& fbl, const Fraction noteStar
 static void addTremolo(ChordRest* cr,
                        const int tremoloNr, const QString& tremoloType,
                        Chord*& tremStart,
-                       MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+                       MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                        Fraction& timeMod)
 {
     if (!cr->isChord()) {
@@ -5592,7 +5592,7 @@ void MusicXMLParserPass2::backup(Fraction& dura)
 //---------------------------------------------------------
 
 MusicXMLParserLyric::MusicXMLParserLyric(const LyricNumberHandler lyricNumberHandler,
-                                         QXmlStreamReader& e, Score* score, MxmlLogger* logger)
+                                         MxmlStreamReader& e, Score* score, MxmlLogger* logger)
     : _lyricNumberHandler(lyricNumberHandler), _e(e), _score(score), _logger(logger)
 {
     // nothing
@@ -5724,7 +5724,7 @@ void MusicXMLParserNotations::slur()
 //---------------------------------------------------------
 
 static void addSlur(const Notation& notation, SlurStack& slurs, ChordRest* cr, const int tick,
-                    MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                    MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     auto slurNo = notation.attribute("number").toInt();
     if (slurNo > 0) {
@@ -6103,7 +6103,7 @@ void MusicXMLParserNotations::glissandoSlide()
 
 static void addGlissandoSlide(const Notation& notation, Note* note,
                               Glissando* glissandi[MAX_NUMBER_LEVEL][2], MusicXmlSpannerMap& spanners,
-                              MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                              MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     auto glissandoNumber = notation.attribute("number").toInt();
     if (glissandoNumber > 0) {
@@ -6162,7 +6162,7 @@ static void addGlissandoSlide(const Notation& notation, Note* note,
 //---------------------------------------------------------
 
 static void addArpeggio(ChordRest* cr, const QString& arpeggioType,
-                        MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                        MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     // no support for arpeggio on rest
     if (!arpeggioType.isEmpty() && cr->type() == ElementType::CHORD) {
@@ -6207,7 +6207,7 @@ static void addArticLaissezVibrer(const Note* const note)
 //---------------------------------------------------------
 
 static void addTie(const Notation& notation, Score* score, Note* note, const track_idx_t track,
-                   Tie*& tie, MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                   Tie*& tie, MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     IF_ASSERT_FAILED(note) {
         return;
@@ -6262,7 +6262,7 @@ static void addTie(const Notation& notation, Score* score, Note* note, const tra
 static void addWavyLine(ChordRest* cr, const Fraction& tick,
                         const int wavyLineNo, const QString& wavyLineType,
                         MusicXmlSpannerMap& spanners, TrillStack& trills,
-                        MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                        MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     if (!wavyLineType.isEmpty()) {
         const auto ticks = cr->ticks();
@@ -6321,7 +6321,7 @@ static void addBreath(ChordRest* cr, const Fraction& tick, SymId breath)
 //---------------------------------------------------------
 
 static void addChordLine(const Notation& notation, Note* note,
-                         MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                         MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     const QString& chordLineType = notation.subType();
     if (chordLineType != "") {
@@ -6447,7 +6447,7 @@ QString Notation::print() const
 //   MusicXMLParserNotations
 //---------------------------------------------------------
 
-MusicXMLParserNotations::MusicXMLParserNotations(QXmlStreamReader& e, Score* score, MxmlLogger* logger)
+MusicXMLParserNotations::MusicXMLParserNotations(MxmlStreamReader& e, Score* score, MxmlLogger* logger)
     : _e(e), _score(score), _logger(logger)
 {
     // nothing
@@ -6817,7 +6817,7 @@ void MusicXMLParserNotations::tuplet()
  MusicXMLParserDirection constructor.
  */
 
-MusicXMLParserDirection::MusicXMLParserDirection(QXmlStreamReader& e,
+MusicXMLParserDirection::MusicXMLParserDirection(MxmlStreamReader& e,
                                                  Score* score,
                                                  const MusicXMLParserPass1& pass1,
                                                  MusicXMLParserPass2& pass2,
@@ -0,0 +1,324 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "importmxmlstreamreader.h"
+
+#include <QHash>
+#include <QIODevice>
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   read
+//---------------------------------------------------------
+
+/**
+ Tokenize the MusicXML document in \a device.
+ A well-formedness error ends the stream with an Invalid token carrying the error,
+ which the reader reports when it gets there, like QXmlStreamReader would.
+ */
+
+std::shared_ptr<const MxmlTokenStream> MxmlTokenStream::read(QIODevice* device)
+{
+    std::shared_ptr<MxmlTokenStream> stream = std::make_shared<MxmlTokenStream>();
+
+    QHash<QString, int> stringIndex;
+    auto intern = [&stringIndex, &stream](const QStringRef& str) {
+        const QString s = str.toString();
+        auto it = stringIndex.constFind(s);
+        if (it != stringIndex.cend()) {
+            return it.value();
+        }
+        const int idx = static_cast<int>(stream->m_strings.size());
+        stream->m_strings.push_back(s);
+        stringIndex.insert(s, idx);
+        return idx;
+    };
+
+    QXmlStreamReader reader(device);
+    while (!reader.atEnd()) {
+        Token token;
+        token.type = reader.readNext();
+
+        switch (token.type) {
+        case QXmlStreamReader::StartElement: {
+            token.string = intern(reader.name());
+            const QXmlStreamAttributes attributes = reader.attributes();
+            if (!attributes.isEmpty()) {
+                // deep copy, the reader's attributes refer to its internal buffer
+                QXmlStreamAttributes copy;
+                copy.reserve(attributes.size());
+                for (const QXmlStreamAttribute& attr : attributes) {
+                    copy.append(attr.qualifiedName().toString(), attr.value().toString());
+                }
+                token.attributes = static_cast<int>(stream->m_attributes.size());
+                stream->m_attributes.push_back(copy);
+            }
+        } break;
+        case QXmlStreamReader::EndElement:
+            token.string = intern(reader.name());
+            break;
+        case QXmlStreamReader::Characters:
+            token.string = intern(reader.text());
+            break;
+        default:
+            // the document end and errors are added below, everything else is not used by the parser
+            continue;
+        }
+
+        token.lineNumber = static_cast<int>(reader.lineNumber());
+        token.columnNumber = static_cast<int>(reader.columnNumber());
+        stream->m_tokens.push_back(token);
+    }
+
+    Token last;
+    last.type = reader.hasError() ? QXmlStreamReader::Invalid : QXmlStreamReader::EndDocument;
+    last.lineNumber = static_cast<int>(reader.lineNumber());
+    last.columnNumber = static_cast<int>(reader.columnNumber());
+    stream->m_tokens.push_back(last);
+    stream->m_tokens.shrink_to_fit();
+
+    stream->m_error = reader.error();
+    stream->m_errorString = reader.errorString();
+
+    return stream;
+}
+
+//---------------------------------------------------------
+//   setTokenStream
+//---------------------------------------------------------
+
+void MxmlStreamReader::setTokenStream(const MxmlTokenStreamPtr& stream)
+{
+    m_stream = stream;
+    m_next = 0;
+    m_type = QXmlStreamReader::NoToken;
+    m_error = QXmlStreamReader::NoError;
+    m_errorString.clear();
+}
+
+//---------------------------------------------------------
+//   readNext
+//---------------------------------------------------------
+
+QXmlStreamReader::TokenType MxmlStreamReader::readNext()
+{
+    if (m_type == QXmlStreamReader::Invalid) {
+        return m_type;
+    }
+
+    if (!m_stream || m_type == QXmlStreamReader::EndDocument || m_next >= m_stream->m_tokens.size()) {
+        setError(QXmlStreamReader::PrematureEndOfDocumentError, QStringLiteral("Premature end of document."));
+        return m_type;
+    }
+
+    m_type = m_stream->m_tokens.at(m_next++).type;
+    if (m_type == QXmlStreamReader::Invalid) {
+        m_error = m_stream->m_error;
+        m_errorString = m_stream->m_errorString;
+    }
+
+    return m_type;
+}
+
+//---------------------------------------------------------
+//   readNextStartElement
+//---------------------------------------------------------
+
+bool MxmlStreamReader::readNextStartElement()
+{
+    while (readNext() != QXmlStreamReader::Invalid) {
+        if (isEndElement() || m_type == QXmlStreamReader::EndDocument) {
+            return false;
+        } else if (isStartElement()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   skipCurrentElement
+//---------------------------------------------------------
+
+void MxmlStreamReader::skipCurrentElement()
+{
+    int depth = 1;
+    while (depth && readNext() != QXmlStreamReader::Invalid) {
+        if (isEndElement()) {
+            --depth;
+        } else if (isStartElement()) {
+            ++depth;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   readElementText
+//---------------------------------------------------------
+
+/**
+ Read the character data of the current start element,
+ with QXmlStreamReader::ErrorOnUnexpectedElement behavior.
+ */
+
+QString MxmlStreamReader::readElementText()
+{
+    if (!isStartElement()) {
+        return QString();
+    }
+
+    QString result;
+    for (;;) {
+        switch (readNext()) {
+        case QXmlStreamReader::Characters:
+            result += text();
+            break;
+        case QXmlStreamReader::EndElement:
+            return result;
+        case QXmlStreamReader::StartElement:
+            setError(QXmlStreamReader::UnexpectedElementError, QStringLiteral("Expected character data."));
+            return result;
+        default:
+            if (hasError() || m_type == QXmlStreamReader::EndDocument) {
+                setError(QXmlStreamReader::NotWellFormedError, QStringLiteral("Expected character data."));
+                return result;
+            }
+            break;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   tokenString
+//---------------------------------------------------------
+
+QString MxmlStreamReader::tokenString() const
+{
+    switch (m_type) {
+    case QXmlStreamReader::NoToken: return QStringLiteral("NoToken");
+    case QXmlStreamReader::Invalid: return QStringLiteral("Invalid");
+    case QXmlStreamReader::StartDocument: return QStringLiteral("StartDocument");
+    case QXmlStreamReader::EndDocument: return QStringLiteral("EndDocument");
+    case QXmlStreamReader::StartElement: return QStringLiteral("StartElement");
+    case QXmlStreamReader::EndElement: return QStringLiteral("EndElement");
+    case QXmlStreamReader::Characters: return QStringLiteral("Characters");
+    case QXmlStreamReader::Comment: return QStringLiteral("Comment");
+    case QXmlStreamReader::DTD: return QStringLiteral("DTD");
+    case QXmlStreamReader::EntityReference: return QStringLiteral("EntityReference");
+    case QXmlStreamReader::ProcessingInstruction: return QStringLiteral("ProcessingInstruction");
+    }
+    return QString();
+}
+
+//---------------------------------------------------------
+//   atEnd
+//---------------------------------------------------------
+
+bool MxmlStreamReader::atEnd() const
+{
+    return m_type == QXmlStreamReader::Invalid || m_type == QXmlStreamReader::EndDocument;
+}
+
+//---------------------------------------------------------
+//   name
+//---------------------------------------------------------
+
+QStringRef MxmlStreamReader::name() const
+{
+    if (!isStartElement() && !isEndElement()) {
+        return QStringRef();
+    }
+    return QStringRef(&m_stream->m_strings.at(currentToken()->string));
+}
+
+//---------------------------------------------------------
+//   text
+//---------------------------------------------------------
+
+QStringRef MxmlStreamReader::text() const
+{
+    if (!isCharacters()) {
+        return QStringRef();
+    }
+    return QStringRef(&m_stream->m_strings.at(currentToken()->string));
+}
+
+//---------------------------------------------------------
+//   attributes
+//---------------------------------------------------------
+
+QXmlStreamAttributes MxmlStreamReader::attributes() const
+{
+    if (!isStartElement() || currentToken()->attributes < 0) {
+        return QXmlStreamAttributes();
+    }
+    return m_stream->m_attributes.at(currentToken()->attributes);
+}
+
+//---------------------------------------------------------
+//   lineNumber / columnNumber
+//---------------------------------------------------------
+
+qint64 MxmlStreamReader::lineNumber() const
+{
+    const MxmlTokenStream::Token* token = currentToken();
+    return token ? token->lineNumber : 0;
+}
+
+qint64 MxmlStreamReader::columnNumber() const
+{
+    const MxmlTokenStream::Token* token = currentToken();
+    return token ? token->columnNumber : 0;
+}
+
+//---------------------------------------------------------
+//   raiseError
+//---------------------------------------------------------
+
+void MxmlStreamReader::raiseError(const QString& message)
+{
+    setError(QXmlStreamReader::CustomError, message);
+}
+
+//---------------------------------------------------------
+//   currentToken
+//---------------------------------------------------------
+
+const MxmlTokenStream::Token* MxmlStreamReader::currentToken() const
+{
+    if (!m_stream || m_next == 0) {
+        return nullptr;
+    }
+    return &m_stream->m_tokens.at(m_next - 1);
+}
+
+//---------------------------------------------------------
+//   setError
+//---------------------------------------------------------
+
+void MxmlStreamReader::setError(QXmlStreamReader::Error error, const QString& message)
+{
+    m_error = error;
+    m_errorString = message;
+    m_type = QXmlStreamReader::Invalid;
+}
+} // namespace Ms
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __IMPORTMXMLSTREAMREADER_H__
+#define __IMPORTMXMLSTREAMREADER_H__
+
+#include <memory>
+#include <vector>
+
+#include <QString>
+#include <QXmlStreamReader>
+
+class QIODevice;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   MxmlTokenStream
+//---------------------------------------------------------
+
+/**
+ The MusicXML document tokenized once into a flat array of element and character data records.
+ Element names and character data are interned, so the many repeated tags
+ and whitespace runs of a large score are stored only once.
+ Immutable once read, so it may be shared by both parser passes.
+ */
+
+class MxmlTokenStream
+{
+public:
+    static std::shared_ptr<const MxmlTokenStream> read(QIODevice* device);
+
+    size_t tokenCount() const { return m_tokens.size(); }
+
+private:
+    friend class MxmlStreamReader;
+
+    struct Token {
+        QXmlStreamReader::TokenType type = QXmlStreamReader::NoToken;
+        int string = -1;        // name for elements, text for character data
+        int attributes = -1;    // start elements only
+        int lineNumber = 0;
+        int columnNumber = 0;
+    };
+
+    std::vector<Token> m_tokens;
+    std::vector<QString> m_strings;
+    std::vector<QXmlStreamAttributes> m_attributes;
+
+    QXmlStreamReader::Error m_error = QXmlStreamReader::NoError;
+    QString m_errorString;
+};
+
+using MxmlTokenStreamPtr = std::shared_ptr<const MxmlTokenStream>;
+
+//---------------------------------------------------------
+//   MxmlStreamReader
+//---------------------------------------------------------
+
+/**
+ Replays an MxmlTokenStream through the subset of the QXmlStreamReader interface
+ used by the MusicXML parser, with the same semantics.
+ Comments, processing instructions and the DTD are not part of the stream.
+ */
+
+class MxmlStreamReader
+{
+public:
+    MxmlStreamReader() = default;
+
+    void setTokenStream(const MxmlTokenStreamPtr& stream);
+
+    QXmlStreamReader::TokenType readNext();
+    bool readNextStartElement();
+    void skipCurrentElement();
+    QString readElementText();
+
+    QXmlStreamReader::TokenType tokenType() const { return m_type; }
+    QString tokenString() const;
+    bool atEnd() const;
+    bool isStartElement() const { return m_type == QXmlStreamReader::StartElement; }
+    bool isEndElement() const { return m_type == QXmlStreamReader::EndElement; }
+    bool isCharacters() const { return m_type == QXmlStreamReader::Characters; }
+
+    QStringRef name() const;
+    QStringRef text() const;
+    QXmlStreamAttributes attributes() const;
+
+    qint64 lineNumber() const;
+    qint64 columnNumber() const;
+
+    void raiseError(const QString& message = QString());
+    QXmlStreamReader::Error error() const { return m_error; }
+    QString errorString() const { return m_errorString; }
+    bool hasError() const { return m_error != QXmlStreamReader::NoError; }
+
+private:
+    const MxmlTokenStream::Token* currentToken() const;
+    void setError(QXmlStreamReader::Error error, const QString& message);
+
+    MxmlTokenStreamPtr m_stream;
+    size_t m_next = 0;
+    QXmlStreamReader::TokenType m_type = QXmlStreamReader::NoToken;
+    QXmlStreamReader::Error m_error = QXmlStreamReader::NoError;
+    QString m_errorString;
+};
+} // namespace Ms
+
+#endif
@@ -24,6 +24,9 @@
  MusicXML import.
  */
 
+#include <future>
+#include <mutex>
+
 #include <QBuffer>
 #include <QDomDocument>
 #include <QMessageBox>
@@ -41,8 +44,22 @@
 
 #include "engraving/dom/masterscore.h"
 
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
 #include "log.h"
 
+static std::shared_ptr<mu::iex::musicxml::IMusicXmlConfiguration> configuration()
+{
+    return mu::modularity::ioc()->resolve<mu::iex::musicxml::IMusicXmlConfiguration>("iex_musicxml");
+}
+
+static bool musicxmlImportValidation()
+{
+    auto conf = configuration();
+    return conf ? conf->musicxmlImportValidation() : true;
+}
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   check assertions for tuplet handling
@@ -104,6 +121,34 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     return true;
 }
 
+//---------------------------------------------------------
+//   CompiledMusicXmlSchema
+//---------------------------------------------------------
+
+/**
+ The MusicXML schema, loaded and compiled once and shared by all imports
+ for the lifetime of the process.
+ */
+
+struct CompiledMusicXmlSchema {
+    ValidatorMessageHandler messageHandler;
+    QXmlSchema schema;
+    bool isValid = false;
+    std::mutex validationMutex;     // QXmlSchema is reentrant, but not thread-safe
+
+    CompiledMusicXmlSchema()
+    {
+        schema.setMessageHandler(&messageHandler);
+        isValid = initMusicXmlSchema(schema);
+    }
+};
+
+static CompiledMusicXmlSchema& compiledMusicXmlSchema()
+{
+    static CompiledMusicXmlSchema s;
+    return s;
+}
+
 //---------------------------------------------------------
 //   musicXMLValidationErrorDialog
 //---------------------------------------------------------
@@ -186,33 +231,52 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
 //---------------------------------------------------------
 
 /**
- Validate MusicXML data from file \a name contained in QIODevice \a dev.
+ Validate MusicXML \a data from file \a name against the compiled schema.
+ Return true if valid, otherwise the validation errors are returned in \a errors.
+ May be called from any thread.
  */
 
-static Err doValidate(const QString& name, QIODevice* dev)
+static bool doValidate(const QString& name, const QByteArray& data, QString& errors)
 {
     //QElapsedTimer t;
     //t.start();
 
-    // initialize the schema
+    CompiledMusicXmlSchema& compiled = compiledMusicXmlSchema();
+
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+
     ValidatorMessageHandler messageHandler;
-    QXmlSchema schema;
-    schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
-        return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
-    }
-    // validate the data
-    QXmlSchemaValidator validator(schema);
-    bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
+
+    std::lock_guard<std::mutex> lock(compiled.validationMutex);
+    QXmlSchemaValidator validator(compiled.schema);
+    validator.setMessageHandler(&messageHandler);
+    bool valid = validator.validate(&buffer, QUrl::fromLocalFile(name));
     //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
+    errors = messageHandler.getErrors();
+    return valid;
+}
+
+//---------------------------------------------------------
+//   validationResult
+//---------------------------------------------------------
+
+/**
+ Convert the outcome of the validation of file \a name into an import result,
+ asking the user whether to continue if the file is not valid.
+ */
+
+static Err validationResult(const QString& name, bool valid, const QString& errors)
+{
     if (!valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
         QString strErr = qtrc("iex_musicxml", "File '%1' is not a valid MusicXML file.").arg(name);
         if (MScore::noGui) {
             return Err::NoError;         // might as well try anyhow in converter mode
         }
-        if (musicXMLValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
+        if (musicXMLValidationErrorDialog(strErr, errors) != QMessageBox::Yes) {
             return Err::UserAbort;
         }
     }
@@ -226,18 +290,39 @@ static Err doValidate(const QString& name, QIODevice* dev)
 
 /**
  Validate and import MusicXML data from file \a name contained in QIODevice \a dev into score \a score.
+ The validation runs on a separate thread, concurrently with the first parser pass.
  */
 
 static Err doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
 {
-    // validate the file
-    Err res = doValidate(name, dev);
-    if (res != Err::NoError) {
-        return res;
+    if (!musicxmlImportValidation()) {
+        return importMusicXMLfromBuffer(score, name, dev);
+    }
+
+    if (!compiledMusicXmlSchema().isValid) {
+        return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
     }
 
+    // both the validator and the parser read from their own buffer over the same (shared) data
+    QBuffer* srcBuffer = qobject_cast<QBuffer*>(dev);
+    const QByteArray data = srcBuffer ? srcBuffer->data() : dev->readAll();
+
+    std::future<std::pair<bool, QString> > validation = std::async(std::launch::async, [name, data]() {
+        QString errors;
+        bool valid = doValidate(name, data, errors);
+        return std::make_pair(valid, errors);
+    });
+
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+
     // actually do the import
-    res = importMusicXMLfromBuffer(score, name, dev);
+    Err res = importMusicXMLfromBuffer(score, name, &buffer, [&validation, &name]() {
+        const std::pair<bool, QString> result = validation.get();
+        return validationResult(name, result.first, result.second);
+    });
+
     //LOGD("res %d", static_cast<int>(res));
     return res;
 }
@@ -14,6 +14,8 @@ set (MUSICXML_SRC
     ${CMAKE_CURRENT_LIST_DIR}/importmxmlpass1.h
     ${CMAKE_CURRENT_LIST_DIR}/importmxmlpass2.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importmxmlpass2.h
+    ${CMAKE_CURRENT_LIST_DIR}/importmxmlstreamreader.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/importmxmlstreamreader.h
     ${CMAKE_CURRENT_LIST_DIR}/importxml.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importxmlfirstpass.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importxmlfirstpass.h
@@ -338,7 +338,7 @@ QString errorStringWithLocation(int line, int col, const QString& error)
 //   checkAtEndElement
 //---------------------------------------------------------
 
-QString checkAtEndElement(const QXmlStreamReader& e, const QString& expName)
+QString checkAtEndElement(const MxmlStreamReader& e, const QString& expName)
 {
     if (e.isEndElement() && e.name() == expName) {
         return "";
@@ -31,6 +31,8 @@
 #include "engraving/dom/mscore.h"
 #include "engraving/dom/note.h"
 
+#include "importmxmlstreamreader.h"
+
 class Chord;
 
 namespace mu::engraving {
@@ -245,6 +247,6 @@ extern AccidentalType microtonalGuess(double val);
 extern bool isLaissezVibrer(const SymId id);
 extern const Articulation* findLaissezVibrer(const Chord* const chord);
 extern QString errorStringWithLocation(int line, int col, const QString& error);
-extern QString checkAtEndElement(const QXmlStreamReader& e, const QString& expName);
+extern QString checkAtEndElement(const MxmlStreamReader& e, const QString& expName);
 } // namespace Ms
 #endif
@@ -116,3 +116,13 @@ void MusicXmlConfiguration::setNeedAskAboutApplyingNewStyle(bool value)
 {
     settings()->setSharedValue(MIGRATION_NOT_ASK_AGAIN_KEY, Val(!value));
 }
+
+bool MusicXmlConfiguration::musicxmlImportValidation() const
+{
+    return m_musicxmlImportValidationOverride ? m_musicxmlImportValidationOverride.value() : true;
+}
+
+void MusicXmlConfiguration::setMusicxmlImportValidationOverride(std::optional<bool> value)
+{
+    m_musicxmlImportValidationOverride = value;
+}
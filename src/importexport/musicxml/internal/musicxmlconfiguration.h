@@ -50,6 +50,12 @@ public:
 
     bool needAskAboutApplyingNewStyle() const override;
     void setNeedAskAboutApplyingNewStyle(bool value) override;
+
+    bool musicxmlImportValidation() const override;
+    void setMusicxmlImportValidationOverride(std::optional<bool> value) override;
+
+private:
+    std::optional<bool> m_musicxmlImportValidationOverride = std::nullopt;
 };
 }
 
@@ -45,6 +45,15 @@ public:
     virtual SizeF pageSizeInch(const Options& opt) const = 0;
 
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE paintView() in two layers: the score, which the view may cache,
+    //! and the interaction overlay (selection, grips, lasso, drop rects...) painted on top of it
+    virtual void paintViewScore(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewOverlay(draw::Painter* painter) = 0;
+
+    //! NOTE Changes whenever what paintViewScore() paints for the page changes
+    virtual size_t pageRevision(int pageIndex) = 0;
+
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
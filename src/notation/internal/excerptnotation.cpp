@@ -49,7 +49,8 @@ void ExcerptNotation::init()
 
     setScore(m_excerpt->excerptScore());
 
-    if (isEmpty()) {
+    //! NOTE The deferred excerpt has no parts until it is read
+    if (isEmpty() && !m_excerpt->isDeferred()) {
         fillWithDefaultInfo();
     }
 
@@ -141,6 +142,8 @@ INotationPtr ExcerptNotation::notation()
 
 IExcerptNotationPtr ExcerptNotation::clone() const
 {
+    m_excerpt->masterScore()->loadDeferredExcerpt(m_excerpt);
+
     mu::engraving::Excerpt* copy = new mu::engraving::Excerpt(*m_excerpt);
     copy->markAsCustom();
 
@@ -595,10 +595,16 @@ void MasterNotation::setExcerptIsOpen(const INotationPtr excerptNotation, bool o
         return;
     }
 
+    mu::engraving::Score* score = excerptNotation->elements()->msScore();
+
+    if (open && score->excerpt()) {
+        masterScore()->loadDeferredExcerpt(score->excerpt());
+    }
+
     excerptNotation->setIsOpen(open);
 
     if (open) {
-        excerptNotation->elements()->msScore()->doLayout();
+        score->doLayout();
     }
 }
 
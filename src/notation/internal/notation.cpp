@@ -84,9 +84,23 @@ Notation::Notation(mu::engraving::Score* score)
     });
 
     engravingConfiguration()->selectionColorChanged().onReceive(this, [this](int, const mu::draw::Color&) {
+        static_cast<NotationPainting*>(m_painting.get())->invalidateDisplayLists();
         notifyAboutNotationChanged();
     });
 
+    // the edits relayout what they change, but the selected and drop target items are colored in place
+    m_notationChanged.onNotify(this, [this]() {
+        static_cast<NotationPainting*>(m_painting.get())->invalidateSelectionDisplayLists();
+    });
+
+    m_interaction->selectionChanged().onNotify(this, [this]() {
+        static_cast<NotationPainting*>(m_painting.get())->invalidateSelectionDisplayLists();
+    });
+
+    m_interaction->dropChanged().onNotify(this, [this]() {
+        static_cast<NotationPainting*>(m_painting.get())->invalidateDisplayLists();
+    });
+
     configuration()->canvasOrientation().ch.onReceive(this, [this](framework::Orientation) {
         if (m_score) {
             m_score->doLayout();
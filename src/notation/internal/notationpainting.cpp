@@ -21,8 +21,15 @@
  */
 #include "notationpainting.h"
 
+#include <algorithm>
+
 #include <QScreen>
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "engraving/dom/mscore.h"
+#include "engraving/dom/page.h"
 #include "engraving/dom/score.h"
 
 #include "notation.h"
@@ -118,16 +125,12 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
     };
 
     scoreRenderer()->paintScore(painter, score(), myopt);
-
-    if (!myopt.isPrinting) {
-        static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
-    }
 }
 
 void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const RectF& pageRect, bool printPageBackground) const
 {
     TRACEFUNC;
-    if (score()->printing()) {
+    if (painter->isPrinting()) {
         if (!printPageBackground) {
             return;
         }
@@ -173,6 +176,15 @@ void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const
 }
 
 void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    paintViewScore(painter, frameRect, isPrinting);
+
+    if (!isPrinting) {
+        paintViewOverlay(painter);
+    }
+}
+
+void NotationPainting::paintViewScore(Painter* painter, const RectF& frameRect, bool isPrinting)
 {
     Options opt;
     opt.isSetViewport = false;
@@ -180,9 +192,167 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
+
+    if (!isPrinting && score()) {
+        updateDisplayListsKey(opt.deviceDpi);
+
+        opt.onPaintPageItems = [this](Painter* painter, Page* page, const RectF& drawRect) {
+            paintPageItems(painter, page, drawRect);
+        };
+    }
+
     doPaint(painter, opt);
 }
 
+void NotationPainting::paintViewOverlay(Painter* painter)
+{
+    if (!score()) {
+        return;
+    }
+
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
+size_t NotationPainting::pageRevision(int pageIndex)
+{
+    if (!score() || pageIndex < 0 || pageIndex >= static_cast<int>(score()->npages())) {
+        return 0;
+    }
+
+    updateDisplayListsKey(uiConfiguration()->logicalDpi());
+
+    return pageEntry(score()->pages().at(pageIndex)).revision;
+}
+
+void NotationPainting::paintPageItems(Painter* painter, Page* page, const RectF& drawRect)
+{
+    TRACEFUNC;
+
+    const PageDisplayList& list = pageDisplayList(page);
+    const std::vector<DrawData::Item>& items = list.data->item.chilren;
+    IF_ASSERT_FAILED(items.size() == list.itemRects.size()) {
+        return;
+    }
+
+    const Transform base = painter->provider()->transform();
+
+    painter->save();
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (list.itemRects[i].intersects(drawRect)) {
+            DrawDataPaint::paintItem(painter, list.data, items[i], base);
+        }
+    }
+    painter->restore();
+}
+
+NotationPainting::PageDisplayList& NotationPainting::pageEntry(const Page* page)
+{
+    PageDisplayList& list = m_displayLists[page];
+    if (list.revision == 0 || list.layoutRevision != page->layoutRevision()) {
+        list = PageDisplayList();
+        list.layoutRevision = page->layoutRevision();
+        list.revision = ++m_lastPageRevision;
+    }
+
+    return list;
+}
+
+const NotationPainting::PageDisplayList& NotationPainting::pageDisplayList(Page* page)
+{
+    PageDisplayList& list = pageEntry(page);
+    if (list.data) {
+        return list;
+    }
+
+    TRACEFUNC;
+
+    std::vector<EngravingItem*> items = page->items(page->layoutData()->bbox());
+    std::sort(items.begin(), items.end(), mu::engraving::elementLessThan);
+
+    auto recorder = std::make_shared<BufferedPaintProvider>();
+    Painter painter(recorder, "page_" + std::to_string(page->no()));
+    painter.setAntialiasing(true);
+    painter.setPixelRatio(engraving::DPI / m_displayListsKey.deviceDpi);
+
+    list.itemRects.clear();
+    for (const EngravingItem* item : items) {
+        if (!item->isInteractionAvailable()) {
+            continue;
+        }
+
+        painter.beginObject(item->typeName());
+        scoreRenderer()->paintItem(painter, item);
+        painter.endObject();
+
+        list.itemRects.push_back(item->pageBoundingRect());
+    }
+    painter.endDraw();
+
+    list.data = recorder->drawData();
+
+    return list;
+}
+
+void NotationPainting::updateDisplayListsKey(int deviceDpi)
+{
+    DisplayListsKey key;
+    key.showInvisible = score()->isShowInvisible();
+    key.showUnprintable = score()->showUnprintable();
+    key.showFrames = score()->showFrames();
+    key.showPageborders = score()->showPageborders();
+    key.markIrregularMeasures = score()->markIrregularMeasures();
+    key.warnPitchRange = mu::engraving::MScore::warnPitchRange;
+    key.scoreInversionEnabled = engravingConfiguration()->scoreInversionEnabled();
+    key.fontPrimaryColor = engravingConfiguration()->fontPrimaryColor();
+    key.deviceDpi = deviceDpi;
+
+    if (key != m_displayListsKey) {
+        m_displayListsKey = key;
+        invalidateDisplayLists();
+        return;
+    }
+
+    // forget the pages removed by the layout
+    if (m_displayLists.size() > score()->npages()) {
+        const std::vector<Page*>& pages = score()->pages();
+        for (auto it = m_displayLists.begin(); it != m_displayLists.end();) {
+            if (std::find(pages.cbegin(), pages.cend(), it->first) == pages.cend()) {
+                it = m_displayLists.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void NotationPainting::invalidateDisplayLists()
+{
+    m_displayLists.clear();
+    m_selectionPages.clear();
+}
+
+void NotationPainting::invalidateSelectionDisplayLists()
+{
+    //! NOTE Selected items are painted in the selection color, without a relayout,
+    //! so the pages of the previous and the current selection are recorded again
+    for (const Page* page : m_selectionPages) {
+        m_displayLists.erase(page);
+    }
+    m_selectionPages.clear();
+
+    if (!score()) {
+        return;
+    }
+
+    for (const EngravingItem* item : score()->selection().elements()) {
+        const EngravingItem* page = item->findAncestor(ElementType::PAGE);
+        if (page) {
+            m_selectionPages.insert(toPage(page));
+            m_displayLists.erase(toPage(page));
+        }
+    }
+}
+
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
 {
     Q_ASSERT(opt.deviceDpi > 0);
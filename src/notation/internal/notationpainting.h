@@ -22,8 +22,13 @@
 #ifndef MU_NOTATION_NOTATIONPAINTING_H
 #define MU_NOTATION_NOTATIONPAINTING_H
 
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #include "../inotationpainting.h"
 
+#include "draw/types/drawdata.h"
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
@@ -55,11 +60,50 @@ public:
     SizeF pageSizeInch(const Options& opt) const override;
 
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewScore(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewOverlay(draw::Painter* painter) override;
+    size_t pageRevision(int pageIndex) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
 
+    //! NOTE For changes of how items look that don't relayout them
+    void invalidateDisplayLists();
+    void invalidateSelectionDisplayLists();
+
 private:
+    //! NOTE The items of a page recorded once, as they are painted on screen,
+    //! and replayed on repaint until the page is laid out again
+    struct PageDisplayList {
+        size_t layoutRevision = 0;
+        size_t revision = 0;
+        draw::DrawDataPtr data;
+        std::vector<RectF> itemRects; // page bounding rect of each recorded item
+    };
+
+    struct DisplayListsKey {
+        bool showInvisible = false;
+        bool showUnprintable = false;
+        bool showFrames = false;
+        bool showPageborders = false;
+        bool markIrregularMeasures = false;
+        bool warnPitchRange = false;
+        bool scoreInversionEnabled = false;
+        draw::Color fontPrimaryColor; // depends on the theme
+        int deviceDpi = 0;
+
+        bool operator==(const DisplayListsKey& k) const
+        {
+            return showInvisible == k.showInvisible && showUnprintable == k.showUnprintable
+                   && showFrames == k.showFrames && showPageborders == k.showPageborders
+                   && markIrregularMeasures == k.markIrregularMeasures && warnPitchRange == k.warnPitchRange
+                   && scoreInversionEnabled == k.scoreInversionEnabled && fontPrimaryColor == k.fontPrimaryColor
+                   && deviceDpi == k.deviceDpi;
+        }
+
+        bool operator!=(const DisplayListsKey& k) const { return !this->operator==(k); }
+    };
+
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
@@ -67,7 +111,17 @@ private:
     void paintPageBorder(draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const engraving::Page* page, const RectF& pageRect, bool printPageBackground) const;
 
+    void paintPageItems(draw::Painter* painter, engraving::Page* page, const RectF& drawRect);
+    PageDisplayList& pageEntry(const engraving::Page* page);
+    const PageDisplayList& pageDisplayList(engraving::Page* page);
+    void updateDisplayListsKey(int deviceDpi);
+
     Notation* m_notation = nullptr;
+
+    std::unordered_map<const engraving::Page*, PageDisplayList> m_displayLists;
+    DisplayListsKey m_displayListsKey;
+    size_t m_lastPageRevision = 0;
+    std::set<const engraving::Page*> m_selectionPages;
 };
 }
 
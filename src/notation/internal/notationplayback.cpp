@@ -70,6 +70,7 @@ void NotationPlayback::init(INotationUndoStackPtr undoStack)
 
     m_playbackModel.setPlayRepeats(configuration()->isPlayRepeatsEnabled());
     m_playbackModel.setPlayChordSymbols(configuration()->isPlayChordSymbolsEnabled());
+    m_playbackModel.setLoadTracksConcurrently(true);
 
     m_playbackModel.load(score());
 
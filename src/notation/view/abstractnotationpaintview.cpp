@@ -24,6 +24,7 @@
 #include <QPainter>
 
 #include "actions/actiontypes.h"
+#include "engraving/dom/mscore.h"
 
 #include "log.h"
 
@@ -218,6 +219,8 @@ void AbstractNotationPaintView::onCurrentNotationChanged()
 
 void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 {
+    m_tileCache.clear();
+
     if (viewport().isValid() && !m_notation->viewState()->isMatrixInited()) {
         m_inputController->initZoom();
     }
@@ -529,6 +532,7 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     rect = correctDrawRect(rect);
 
     mu::draw::Painter mup(qp, objectName().toStdString());
+    mup.setPixelRatio(engraving::DPI / uiConfiguration()->logicalDpi());
     mu::draw::Painter* painter = &mup;
 
     paintBackground(rect, painter);
@@ -541,10 +545,18 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
-
+    const Transform viewTransform = m_matrix * guiScalingCompensation;
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    //! NOTE The score comes from the tile cache, everything that moves or changes
+    //! without an edit (cursors, markers, selection and other overlays) is painted over it
+    m_tileCache.paint(qp, notation(), viewTransform, rect, isPrinting);
+
+    painter->setWorldTransform(viewTransform);
+
+    if (!isPrinting) {
+        notation()->painting()->paintViewOverlay(painter);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -580,14 +592,17 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         redraw();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         redraw();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         redraw();
     });
 }
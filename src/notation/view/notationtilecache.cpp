@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <QPainter>
+
+#include "draw/painter.h"
+
+#include "engraving/dom/page.h"
+#include "engraving/dom/score.h"
+
+#include "realfn.h"
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::draw;
+
+//! NOTE Tile side in painter units, and the memory kept for tiles (128 tiles at a device pixel ratio of 2)
+static constexpr int TILE_SIZE = 256;
+static constexpr qint64 MAX_CACHE_BYTES = 128ll * 1024 * 1024;
+
+void NotationTileCache::paint(QPainter* painter, INotationPtr notation, const Transform& viewTransform, const RectF& rect,
+                              bool isPrinting)
+{
+    TRACEFUNC;
+
+    if (!notation) {
+        return;
+    }
+
+    const engraving::Score* score = notation->elements()->msScore();
+    if (!score) {
+        return;
+    }
+
+    const double scaling = viewTransform.m11();
+    const qreal devicePixelRatio = painter->device()->devicePixelRatioF();
+    if (!RealIsEqual(scaling, m_scaling) || !RealIsEqual(devicePixelRatio, m_devicePixelRatio) || isPrinting != m_isPrinting) {
+        clear();
+        m_scaling = scaling;
+        m_devicePixelRatio = devicePixelRatio;
+        m_isPrinting = isPrinting;
+    }
+
+    ++m_frame;
+
+    // tiles are laid out in the scaled notation space, the translation only moves them
+    const PointF offset(viewTransform.dx(), viewTransform.dy());
+    const RectF visibleRect = rect.translated(-offset);
+
+    painter->save();
+    painter->resetTransform();
+
+    const std::vector<engraving::Page*>& pages = score->pages();
+    for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
+        const engraving::Page* page = pages.at(pageIndex);
+        const RectF pageRect = page->layoutData()->bbox().translated(page->pos());
+        const RectF scaledPageRect(pageRect.x() * scaling, pageRect.y() * scaling, pageRect.width() * scaling,
+                                   pageRect.height() * scaling);
+
+        const RectF paintRect = scaledPageRect.intersected(visibleRect);
+        if (paintRect.isEmpty()) {
+            continue;
+        }
+
+        const size_t pageRevision = notation->painting()->pageRevision(static_cast<int>(pageIndex));
+
+        const int firstColumn = static_cast<int>(std::floor(paintRect.left() / TILE_SIZE));
+        const int lastColumn = static_cast<int>(std::ceil(paintRect.right() / TILE_SIZE));
+        const int firstRow = static_cast<int>(std::floor(paintRect.top() / TILE_SIZE));
+        const int lastRow = static_cast<int>(std::ceil(paintRect.bottom() / TILE_SIZE));
+
+        for (int row = firstRow; row < lastRow; ++row) {
+            for (int column = firstColumn; column < lastColumn; ++column) {
+                const TileKey key { static_cast<int>(pageIndex), column, row };
+                Tile& tile = m_tiles[key];
+                if (tile.image.isNull() || tile.pageRevision != pageRevision) {
+                    renderTile(tile, key, notation, pageRect, isPrinting);
+                    tile.pageRevision = pageRevision;
+                }
+                tile.lastUse = m_frame;
+
+                const QPointF tilePos(column * TILE_SIZE + offset.x(), row * TILE_SIZE + offset.y());
+                painter->drawImage(tilePos, tile.image);
+            }
+        }
+    }
+
+    painter->restore();
+
+    evictTiles();
+}
+
+void NotationTileCache::renderTile(Tile& tile, const TileKey& key, INotationPtr notation, const RectF& pageRect,
+                                   bool isPrinting) const
+{
+    TRACEFUNC;
+
+    const int pixelSize = static_cast<int>(std::ceil(TILE_SIZE * m_devicePixelRatio));
+    if (tile.image.isNull()) {
+        tile.image = QImage(pixelSize, pixelSize, QImage::Format_ARGB32_Premultiplied);
+        tile.image.setDevicePixelRatio(m_devicePixelRatio);
+    }
+    tile.image.fill(Qt::transparent);
+
+    const double tileX = key.column * TILE_SIZE;
+    const double tileY = key.row * TILE_SIZE;
+    const RectF frameRect(tileX / m_scaling, tileY / m_scaling, TILE_SIZE / m_scaling, TILE_SIZE / m_scaling);
+
+    Painter painter(&tile.image, "notationtile");
+    painter.setWorldTransform(Transform(m_scaling, 0.0, 0.0, m_scaling, -tileX, -tileY));
+
+    // only this page, the neighbour pages have their own tiles
+    painter.setClipRect(pageRect);
+    painter.setClipping(true);
+
+    notation->painting()->paintViewScore(&painter, frameRect.intersected(pageRect), isPrinting);
+    painter.endDraw();
+}
+
+void NotationTileCache::evictTiles()
+{
+    const qint64 tileBytes = static_cast<qint64>(std::ceil(TILE_SIZE * m_devicePixelRatio) * std::ceil(TILE_SIZE * m_devicePixelRatio)) * 4;
+    const size_t maxTiles = static_cast<size_t>(std::max<qint64>(1, MAX_CACHE_BYTES / tileBytes));
+    if (m_tiles.size() <= maxTiles) {
+        return;
+    }
+
+    // the least recently painted first, the tiles of the current frame are kept
+    std::vector<std::pair<uint64_t, TileKey> > uses;
+    uses.reserve(m_tiles.size());
+    for (const auto& p : m_tiles) {
+        if (p.second.lastUse != m_frame) {
+            uses.push_back({ p.second.lastUse, p.first });
+        }
+    }
+    std::sort(uses.begin(), uses.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (const auto& use : uses) {
+        if (m_tiles.size() <= maxTiles) {
+            break;
+        }
+        m_tiles.erase(use.second);
+    }
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <map>
+
+#include <QImage>
+
+#include "notation/inotation.h"
+
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Keeps the score painted into raster tiles at the current zoom,
+//! so that scrolling and panning only composite tiles, and repaints only the pages that changed.
+//! Cursors, loop markers and the interaction overlay are not part of the tiles.
+class NotationTileCache
+{
+public:
+    NotationTileCache() = default;
+
+    //! NOTE viewTransform maps the notation to the painter, rect is the part of the painter to paint
+    void paint(QPainter* painter, INotationPtr notation, const draw::Transform& viewTransform, const RectF& rect, bool isPrinting);
+
+    void clear();
+
+private:
+    struct TileKey {
+        int page = 0;
+        int column = 0;
+        int row = 0;
+
+        bool operator<(const TileKey& k) const
+        {
+            if (page != k.page) {
+                return page < k.page;
+            }
+            if (row != k.row) {
+                return row < k.row;
+            }
+            return column < k.column;
+        }
+    };
+
+    struct Tile {
+        size_t pageRevision = 0;
+        uint64_t lastUse = 0;
+        QImage image;
+    };
+
+    void renderTile(Tile& tile, const TileKey& key, INotationPtr notation, const RectF& pageRect, bool isPrinting) const;
+    void evictTiles();
+
+    std::map<TileKey, Tile> m_tiles;
+
+    double m_scaling = 0.0;
+    qreal m_devicePixelRatio = 0.0;
+    bool m_isPrinting = false;
+    uint64_t m_frame = 0;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
@@ -26,6 +26,7 @@
 #include <QMimeData>
 
 #include "engraving/dom/engravingitem.h"
+#include "engraving/dom/mscore.h"
 #include "engraving/dom/page.h"
 #include "engraving/dom/system.h"
 
@@ -153,7 +154,6 @@ void ExampleView::drawBackground(mu::draw::Painter* p, const RectF& r) const
 void ExampleView::drawElements(mu::draw::Painter& painter, const std::vector<EngravingItem*>& el)
 {
     for (EngravingItem* e : el) {
-        e->itemDiscovered = 0;
         PointF pos(e->pagePos());
         painter.translate(pos);
         EngravingItem::renderer()->drawItem(e, &painter);
@@ -171,6 +171,7 @@ void ExampleView::paintEvent(QPaintEvent* event)
 
     mu::draw::Painter painter(this, "exampleview");
     painter.setAntialiasing(true);
+    painter.setPixelRatio(mu::engraving::DPI / logicalDpiX());
     const RectF rect = RectF::fromQRectF(event->rect());
 
     drawBackground(&painter, rect);
@@ -165,7 +165,7 @@ void PaletteCellIconEngine::paintScoreElement(Painter& painter, EngravingItem* i
 
     painter.save();
 
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / dpi;
+    painter.setPixelRatio(mu::engraving::DPI / dpi);
 
     const qreal sizeRatio = spatium / gpaletteScore->style().spatium();
     painter.scale(sizeRatio, sizeRatio); // scale coordinates so element is drawn at correct size
@@ -112,6 +112,7 @@ void KeyCanvas::paintEvent(QPaintEvent*)
 {
     mu::draw::Painter painter(this, "keycanvas");
     painter.setAntialiasing(true);
+    painter.setPixelRatio(engraving::DPI / logicalDpiX());
     qreal wh = double(height());
     qreal ww = double(width());
     double y = wh * .5 - 2 * configuration()->paletteSpatium() * extraMag;
@@ -53,6 +53,7 @@
 #include "engraving/dom/fret.h"
 #include "engraving/dom/image.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/mscore.h"
 #include "engraving/dom/note.h"
 #include "engraving/dom/symbol.h"
 #include "engraving/dom/factory.h"
@@ -610,6 +611,7 @@ QPixmap PaletteWidget::pixmapForCellAt(int paletteIdx) const
 
     mu::draw::Painter painter(&pm, "palette");
     painter.setAntialiasing(true);
+    painter.setPixelRatio(mu::engraving::DPI / pm.logicalDpiX());
 
     painter.scale(cellMag, cellMag);
 
@@ -953,6 +955,7 @@ void PaletteWidget::paintEvent(QPaintEvent* /*event*/)
 
     mu::draw::Painter painter(this, "palette");
     painter.setAntialiasing(true);
+    painter.setPixelRatio(mu::engraving::DPI / logicalDpiX());
 
     if (m_paintOptions.backgroundColor.isValid()) {
         painter.setBrush(m_paintOptions.backgroundColor);
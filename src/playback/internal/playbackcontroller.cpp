@@ -1345,6 +1345,13 @@ void PlaybackController::applyProfile(const SoundProfileName& profileName)
 
         AudioInputParams newInputParams { profile.findResource(playbackData.setupData), {} };
 
+        //! NOTE The render shards are set per track, they don't depend on the sound profile
+        const AudioInputParams oldInputParams = audioSettingsPtr->trackInputParams(pair.first);
+        auto shardsIt = oldInputParams.configuration.find(FLUID_RENDER_SHARDS_CONFIG_KEY);
+        if (shardsIt != oldInputParams.configuration.cend()) {
+            newInputParams.configuration.insert(*shardsIt);
+        }
+
         playback()->tracks()->setInputParams(m_currentSequenceId, pair.second, std::move(newInputParams));
     }
 
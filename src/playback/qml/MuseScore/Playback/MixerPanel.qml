@@ -72,6 +72,7 @@ ColumnLayout {
         id: mixerPanelModel
 
         navigationSection: root.navigationSection
+        metersVisible: root.visible && contextMenuModel.faderSectionVisible
 
         Component.onCompleted: {
             mixerPanelModel.load()
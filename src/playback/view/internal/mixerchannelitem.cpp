@@ -70,7 +70,9 @@ MixerChannelItem::MixerChannelItem(QObject* parent, Type type, bool outputOnly,
 
 MixerChannelItem::~MixerChannelItem()
 {
-    m_audioSignalChanges.resetOnReceive(this);
+    if (m_audioSignalsMeter && m_audioSignalsObserved) {
+        m_audioSignalsMeter->removeObserver();
+    }
 }
 
 MixerChannelItem::Type MixerChannelItem::type() const
@@ -357,17 +359,56 @@ void MixerChannelItem::loadSoloMuteState(project::IProjectAudioSettings::SoloMut
     }
 }
 
-void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioSignalChanges)
+void MixerChannelItem::setAudioSignalsMeter(AudioSignalsMeterPtr meter)
 {
-    m_audioSignalChanges = audioSignalChanges;
+    if (m_audioSignalsMeter == meter) {
+        return;
+    }
 
-    m_audioSignalChanges.onReceive(this, [this](const audioch_t audioChNum, const AudioSignalVal& newValue) {
-        //!Note There should be no signal changes when the mixer channel is muted.
-        //!     But some audio signal changes still might be "on the way" from the times when the mixer channel wasn't muted
-        //!     So that we have to just ignore them
-        if (muted()) {
-            return;
+    //! NOTE The audio worker measures the signal of the channel only while its meter is observed
+    if (m_audioSignalsMeter && m_audioSignalsObserved) {
+        m_audioSignalsMeter->removeObserver();
+    }
+
+    m_audioSignalsMeter = std::move(meter);
+
+    if (m_audioSignalsMeter && m_audioSignalsObserved) {
+        m_audioSignalsMeter->addObserver();
+    }
+}
+
+void MixerChannelItem::setAudioSignalsObserved(bool observed)
+{
+    if (m_audioSignalsObserved == observed) {
+        return;
+    }
+
+    m_audioSignalsObserved = observed;
+
+    if (m_audioSignalsMeter) {
+        if (observed) {
+            m_audioSignalsMeter->addObserver();
+        } else {
+            m_audioSignalsMeter->removeObserver();
         }
+    }
+
+    if (!observed) {
+        resetAudioChannelsVolumePressure();
+    }
+}
+
+void MixerChannelItem::updateAudioSignals()
+{
+    //!Note There should be no signal changes when the mixer channel is muted.
+    //!     But the meter still might keep the values from the times when the mixer channel wasn't muted
+    //!     So that we have to just ignore them
+    if (!m_audioSignalsMeter || muted()) {
+        return;
+    }
+
+    for (audioch_t audioChNum = 0; audioChNum < AudioSignalsMeter::MAX_AUDIO_CHANNELS_COUNT; ++audioChNum) {
+        const AudioSignalVal newValue = m_audioSignalsMeter->signalValue(audioChNum);
 
         if (newValue.pressure < MIN_DISPLAYED_DBFS) {
             setAudioChannelVolumePressure(audioChNum, MIN_DISPLAYED_DBFS);
@@ -376,7 +417,7 @@ void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioS
         } else {
             setAudioChannelVolumePressure(audioChNum, newValue.pressure);
         }
-    });
+    }
 }
 
 void MixerChannelItem::setTitle(QString title)
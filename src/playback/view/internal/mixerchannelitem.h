@@ -112,7 +112,10 @@ public:
     void loadOutputParams(audio::AudioOutputParams&& newParams);
     void loadSoloMuteState(project::IProjectAudioSettings::SoloMuteState&& newState);
 
-    void subscribeOnAudioSignalChanges(audio::AudioSignalChanges&& audioSignalChanges);
+    void setAudioSignalsMeter(audio::AudioSignalsMeterPtr meter);
+    void setAudioSignalsObserved(bool observed);
+    void updateAudioSignals();
+    void resetAudioChannelsVolumePressure();
 
     bool outputOnly() const;
 
@@ -161,7 +164,6 @@ signals:
 
 protected:
     void setAudioChannelVolumePressure(const audio::audioch_t chNum, const float newValue);
-    void resetAudioChannelsVolumePressure();
 
     void applyMuteToOutputParams(const bool isMuted);
 
@@ -193,7 +195,8 @@ protected:
     QMap<audio::AudioFxChainOrder, OutputResourceItem*> m_outputResourceItems;
     QMap<audio::aux_channel_idx_t, AuxSendItem*> m_auxSendItems;
 
-    audio::AudioSignalChanges m_audioSignalChanges;
+    audio::AudioSignalsMeterPtr m_audioSignalsMeter = nullptr;
+    bool m_audioSignalsObserved = false;
 
     QString m_title;
     bool m_outputOnly = false;
@@ -34,6 +34,7 @@ using namespace mu::notation;
 using namespace mu::project;
 
 static constexpr int INVALID_INDEX = -1;
+static constexpr int AUDIO_SIGNALS_UPDATE_INTERVAL_MSECS = 16; // ~60 fps
 
 MixerPanelModel::MixerPanelModel(QObject* parent)
     : QAbstractListModel(parent)
@@ -41,6 +42,19 @@ MixerPanelModel::MixerPanelModel(QObject* parent)
     controller()->currentTrackSequenceIdChanged().onNotify(this, [this]() {
         load();
     });
+
+    //! NOTE The meters are polled for all the channels at once, at the display rate,
+    //! and only while something is played and the meters are visible
+    m_audioSignalsUpdateTimer.setInterval(AUDIO_SIGNALS_UPDATE_INTERVAL_MSECS);
+    connect(&m_audioSignalsUpdateTimer, &QTimer::timeout, this, [this]() {
+        for (MixerChannelItem* item : m_mixerChannelList) {
+            item->updateAudioSignals();
+        }
+    });
+
+    controller()->isPlayingChanged().onNotify(this, [this]() {
+        updateAudioSignalsUpdateTimer();
+    });
 }
 
 void MixerPanelModel::load()
@@ -431,6 +445,7 @@ MixerChannelItem* MixerPanelModel::buildInstrumentChannelItem(const audio::Track
     MixerChannelItem* item = new MixerChannelItem(this, type, false /*outputOnly*/, trackId);
     item->setInstrumentTrackId(instrumentTrackId);
     item->setPanelSection(m_navigationSection);
+    item->setAudioSignalsObserved(m_metersVisible);
     item->loadSoloMuteState(audioSettings()->trackSoloMuteState(instrumentTrackId));
 
     playback()->tracks()->inputParams(m_currentTrackSequenceId, trackId)
@@ -466,14 +481,14 @@ MixerChannelItem* MixerPanelModel::buildInstrumentChannelItem(const audio::Track
                << ", " << text;
     });
 
-    playback()->audioOutput()->signalChanges(m_currentTrackSequenceId, trackId)
-    .onResolve(this, [this, trackId](AudioSignalChanges signalChanges) {
+    playback()->audioOutput()->signalsMeter(m_currentTrackSequenceId, trackId)
+    .onResolve(this, [this, trackId](AudioSignalsMeterPtr meter) {
         if (MixerChannelItem* item = findChannelItem(trackId)) {
-            item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+            item->setAudioSignalsMeter(std::move(meter));
         }
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get the audio signals meter of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -504,6 +519,7 @@ MixerChannelItem* MixerPanelModel::buildAuxChannelItem(aux_channel_idx_t index,
 {
     MixerChannelItem* item = new MixerChannelItem(this, MixerChannelItem::Type::Aux, true /*outputOnly*/, trackId);
     item->setPanelSection(m_navigationSection);
+    item->setAudioSignalsObserved(m_metersVisible);
     item->loadSoloMuteState(audioSettings()->auxSoloMuteState(index));
 
     playback()->tracks()->trackName(m_currentTrackSequenceId, trackId)
@@ -528,14 +544,14 @@ MixerChannelItem* MixerPanelModel::buildAuxChannelItem(aux_channel_idx_t index,
                << ", " << text;
     });
 
-    playback()->audioOutput()->signalChanges(m_currentTrackSequenceId, trackId)
-    .onResolve(this, [this, trackId](AudioSignalChanges signalChanges) {
+    playback()->audioOutput()->signalsMeter(m_currentTrackSequenceId, trackId)
+    .onResolve(this, [this, trackId](AudioSignalsMeterPtr meter) {
         if (MixerChannelItem* item = findChannelItem(trackId)) {
-            item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+            item->setAudioSignalsMeter(std::move(meter));
         }
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get the audio signals meter of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -555,6 +571,7 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
 {
     MixerChannelItem* item = new MixerChannelItem(this, MixerChannelItem::Type::Master, true /*outputOnly*/);
     item->setPanelSection(m_navigationSection);
+    item->setAudioSignalsObserved(m_metersVisible);
     item->setTitle(qtrc("playback", "Master"));
 
     playback()->audioOutput()->masterOutputParams()
@@ -566,12 +583,12 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
                << ", " << text;
     });
 
-    playback()->audioOutput()->masterSignalChanges()
-    .onResolve(this, [item](AudioSignalChanges signalChanges) {
-        item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+    playback()->audioOutput()->masterSignalsMeter()
+    .onResolve(this, [item](AudioSignalsMeterPtr meter) {
+        item->setAudioSignalsMeter(std::move(meter));
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from master channel, error code: " << errCode
+        LOGE() << "unable to get the audio signals meter of master channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -661,3 +678,40 @@ void MixerPanelModel::setNavigationSection(ui::NavigationSection* navigationSect
     m_navigationSection = navigationSection;
     emit navigationSectionChanged();
 }
+
+bool MixerPanelModel::metersVisible() const
+{
+    return m_metersVisible;
+}
+
+void MixerPanelModel::setMetersVisible(bool visible)
+{
+    if (m_metersVisible == visible) {
+        return;
+    }
+
+    m_metersVisible = visible;
+
+    //! NOTE The audio worker skips the measuring of the channels whose meters are not observed
+    for (MixerChannelItem* item : m_mixerChannelList) {
+        item->setAudioSignalsObserved(visible);
+    }
+
+    updateAudioSignalsUpdateTimer();
+
+    emit metersVisibleChanged();
+}
+
+void MixerPanelModel::updateAudioSignalsUpdateTimer()
+{
+    if (m_metersVisible && controller()->isPlaying()) {
+        m_audioSignalsUpdateTimer.start();
+        return;
+    }
+
+    m_audioSignalsUpdateTimer.stop();
+
+    for (MixerChannelItem* item : m_mixerChannelList) {
+        item->resetAudioChannelsVolumePressure();
+    }
+}
@@ -25,6 +25,7 @@
 
 #include <QAbstractListModel>
 #include <QList>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -52,6 +53,8 @@ class MixerPanelModel : public QAbstractListModel, public async::Asyncable
 
     Q_PROPERTY(int count READ rowCount NOTIFY rowCountChanged)
 
+    Q_PROPERTY(bool metersVisible READ metersVisible WRITE setMetersVisible NOTIFY metersVisibleChanged)
+
 public:
     explicit MixerPanelModel(QObject* parent = nullptr);
 
@@ -65,9 +68,13 @@ public:
     ui::NavigationSection* navigationSection() const;
     void setNavigationSection(ui::NavigationSection* navigationSection);
 
+    bool metersVisible() const;
+    void setMetersVisible(bool visible);
+
 signals:
     void navigationSectionChanged();
     void rowCountChanged();
+    void metersVisibleChanged();
 
 private:
     enum Roles {
@@ -81,6 +88,7 @@ private:
     void updateItemsPanelsOrder();
     void clear();
     void setupConnections();
+    void updateAudioSignalsUpdateTimer();
 
     int resolveInsertIndex(const engraving::InstrumentTrackId& instrumentTrackId) const;
     int indexOf(const audio::TrackId trackId) const;
@@ -106,6 +114,9 @@ private:
     MixerChannelItem* m_masterChannelItem = nullptr;
     audio::TrackSequenceId m_currentTrackSequenceId = -1;
 
+    QTimer m_audioSignalsUpdateTimer;
+    bool m_metersVisible = false;
+
     ui::NavigationSection* m_navigationSection = nullptr;
 };
 }
@@ -27,6 +27,7 @@
 #include "score.h"
 
 #include "engraving/dom/measurebase.h"
+#include "engraving/dom/mscore.h"
 #include "engraving/dom/page.h"
 #include "engraving/dom/score.h"
 #include "engraving/dom/system.h"
@@ -179,6 +180,7 @@ void ScoreView::paint(QPainter* qp)
 {
     mu::draw::Painter p(qp, "plugins_scoreview");
     p.setAntialiasing(true);
+    p.setPixelRatio(mu::engraving::DPI / qp->device()->logicalDpiX());
     p.fillRect(mu::RectF(0.0, 0.0, width(), height()), _color);
     if (!score) {
         return;
@@ -23,6 +23,8 @@
 
 #include "exportprojectscenario.h"
 
+#include "engraving/dom/masterscore.h"
+
 #include "translation.h"
 #include "defer.h"
 #include "log.h"
@@ -128,9 +130,13 @@ bool ExportProjectScenario::exportScores(const notation::INotationPtrList& notat
 
     masterNotation()->initExcerpts(excerptsToInit);
 
-    // Scores that are closed may have never been laid out, so we lay them out now
+    // Scores that are closed may have never been read and laid out, so we do it now
     for (INotationPtr notation : notations) {
         mu::engraving::Score* score = notation->elements()->msScore();
+        if (score->excerpt()) {
+            score->masterScore()->loadDeferredExcerpt(score->excerpt());
+        }
+
         if (!score->autoLayoutEnabled()) {
             score->doLayout();
         }
@@ -262,6 +262,12 @@ mu::Ret NotationProject::doLoad(const io::path_t& path, const io::path_t& styleP
         excerpt->notation()->viewState()->read(reader, u"Excerpts/" + excerpt->name() + u"/");
     }
 
+    // The scores are the same as in the file, if it was written by this version
+    if (masterScore->mscVersion() == Constants::MSC_VERSION
+        && masterScore->mscoreVersion() == String::fromAscii(MUSESCORE_VERSION)) {
+        markScoresAsSaved();
+    }
+
     return make_ret(Ret::Code::Ok);
 }
 
@@ -599,6 +605,20 @@ mu::Ret NotationProject::doSave(const io::path_t& path, engraving::MscIoMode ioM
             return make_ret(Ret::Code::InternalError);
         }
 
+        //! NOTE Incremental saving: unchanged files are copied from the current version of the project file
+        MscReader previousVersionReader;
+        if (canSaveIncrementally(path, ioMode)) {
+            MscReader::Params readerParams;
+            readerParams.filePath = path;
+            readerParams.mainFileName = params.mainFileName;
+            readerParams.mode = ioMode;
+
+            previousVersionReader.setParams(readerParams);
+            if (previousVersionReader.open()) {
+                params.previousVersion = &previousVersionReader;
+            }
+        }
+
         MscWriter msczWriter(params);
         Ret ret = writeProject(msczWriter, false /*onlySelection*/, createThumbnail);
         msczWriter.close();
@@ -664,6 +684,25 @@ mu::Ret NotationProject::doSave(const io::path_t& path, engraving::MscIoMode ioM
     return make_ret(Ret::Code::Ok);
 }
 
+bool NotationProject::canSaveIncrementally(const io::path_t& path, engraving::MscIoMode ioMode) const
+{
+    if (ioMode != MscIoMode::Zip || isNewlyCreated() || path != m_path) {
+        return false;
+    }
+
+    //! NOTE The file could be changed by someone else since we saved or loaded it
+    return fileSystem()->exists(path) && fileSystem()->lastModified(path) == m_savedFileLastModified;
+}
+
+void NotationProject::markScoresAsSaved()
+{
+    m_savedFileLastModified = fileSystem()->lastModified(m_path);
+
+    for (mu::engraving::Score* score : m_engravingProject->masterScore()->scoreList()) {
+        score->setModifiedSinceSave(false);
+    }
+}
+
 mu::Ret NotationProject::makeCurrentFileAsBackup()
 {
     TRACEFUNC;
@@ -884,6 +923,8 @@ void NotationProject::markAsSaved(const io::path_t& path)
 
     setPath(path);
 
+    markScoresAsSaved();
+
     m_masterNotation->notation()->undoStack()->stackChanged().notify();
 }
 
@@ -108,6 +108,8 @@ private:
     Ret exportProject(const io::path_t& path, const std::string& suffix);
     Ret doSave(const io::path_t& path, engraving::MscIoMode ioMode, bool generateBackup = true, bool createThumbnail = true);
     Ret makeCurrentFileAsBackup();
+    bool canSaveIncrementally(const io::path_t& path, engraving::MscIoMode ioMode) const;
+    void markScoresAsSaved();
     Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection, bool createThumbnail = true);
 
     void listenIfNeedSaveChanges();
@@ -129,6 +131,7 @@ private:
     bool m_isImported = false;
     bool m_needAutoSave = false;
     bool m_hasNonUndoStackChanges = false;
+    DateTime m_savedFileLastModified;
 };
 }
 
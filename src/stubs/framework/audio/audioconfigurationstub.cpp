@@ -76,6 +76,24 @@ samples_t AudioConfigurationStub::renderStep() const
     return 0;
 }
 
+bool AudioConfigurationStub::isPreRenderEnabled() const
+{
+    return false;
+}
+
+void AudioConfigurationStub::setPreRenderEnabled(bool)
+{
+}
+
+int AudioConfigurationStub::fluidRenderShards() const
+{
+    return 1;
+}
+
+void AudioConfigurationStub::setFluidRenderShards(int)
+{
+}
+
 unsigned int AudioConfigurationStub::sampleRate() const
 {
     return 0;
@@ -119,3 +137,13 @@ io::path_t AudioConfigurationStub::knownAudioPluginsFilePath() const
 {
     return {};
 }
+
+io::path_t AudioConfigurationStub::soundFontSamplesCachePath() const
+{
+    return {};
+}
+
+io::path_t AudioConfigurationStub::soundFontIndexFilePath() const
+{
+    return {};
+}
@@ -44,6 +44,12 @@ public:
     async::Notification driverBufferSizeChanged() const override;
     samples_t renderStep() const override;
 
+    bool isPreRenderEnabled() const override;
+    void setPreRenderEnabled(bool enabled) override;
+
+    int fluidRenderShards() const override;
+    void setFluidRenderShards(int shards) override;
+
     unsigned int sampleRate() const override;
     void setSampleRate(unsigned int sampleRate) override;
     async::Notification sampleRateChanged() const override;
@@ -57,6 +63,8 @@ public:
     async::Channel<io::paths_t> soundFontDirectoriesChanged() const override;
 
     io::path_t knownAudioPluginsFilePath() const override;
+    io::path_t soundFontSamplesCachePath() const override;
+    io::path_t soundFontIndexFilePath() const override;
 };
 }
 
@@ -59,6 +59,9 @@ struct _fluid_samplecache_entry_t
 static fluid_list_t *samplecache_list = NULL;
 static fluid_mutex_t samplecache_mutex = FLUID_MUTEX_INIT;
 
+static fluid_samplecache_load_func_t samplecache_persistent_load = NULL;
+static fluid_samplecache_store_func_t samplecache_persistent_store = NULL;
+
 static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf, unsigned int sample_start,
         unsigned int sample_end, int sample_type, time_t mtime);
 static fluid_samplecache_entry_t *get_samplecache_entry(SFData *sf, unsigned int sample_start,
@@ -135,6 +138,15 @@ unlock_exit:
     return ret;
 }
 
+void fluid_samplecache_set_persistent_funcs(fluid_samplecache_load_func_t load_func,
+        fluid_samplecache_store_func_t store_func)
+{
+    fluid_mutex_lock(samplecache_mutex);
+    samplecache_persistent_load = load_func;
+    samplecache_persistent_store = store_func;
+    fluid_mutex_unlock(samplecache_mutex);
+}
+
 int fluid_samplecache_unload(const short *sample_data)
 {
     fluid_list_t *entry_list;
@@ -221,6 +233,20 @@ static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
     entry->sample_type = sample_type;
     entry->modification_time = mtime;
 
+    /* MuseScore: decoding Ogg Vorbis is expensive, so try the persistent storage first */
+    if((sample_type & FLUID_SAMPLETYPE_OGG_VORBIS) && samplecache_persistent_load != NULL)
+    {
+        entry->sample_count = samplecache_persistent_load(sf->fname, mtime, sample_start, sample_end,
+                              &entry->sample_data);
+
+        if(entry->sample_count >= 0)
+        {
+            return entry;
+        }
+
+        entry->sample_data = NULL;
+    }
+
     entry->sample_count = fluid_sffile_read_sample_data(sf, sample_start, sample_end, sample_type,
                           &entry->sample_data, &entry->sample_data24);
 
@@ -229,6 +255,12 @@ static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
         goto error_exit;
     }
 
+    if((sample_type & FLUID_SAMPLETYPE_OGG_VORBIS) && samplecache_persistent_store != NULL)
+    {
+        samplecache_persistent_store(sf->fname, mtime, sample_start, sample_end,
+                                     entry->sample_data, entry->sample_count);
+    }
+
     return entry;
 
 error_exit:
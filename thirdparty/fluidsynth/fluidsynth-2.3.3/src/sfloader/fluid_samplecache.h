@@ -31,6 +31,17 @@ int fluid_samplecache_load(SFData *sf,
 
 int fluid_samplecache_unload(const short *sample_data);
 
+/* MuseScore: optional persistent storage for decoded Ogg Vorbis samples.
+ * The load function returns the sample count and the data allocated with FLUID_MALLOC,
+ * or -1 if the sample is not stored. The store function must copy the data. */
+typedef int (*fluid_samplecache_load_func_t)(const char *filename, time_t mtime,
+        unsigned int sample_start, unsigned int sample_end, short **data);
+typedef void (*fluid_samplecache_store_func_t)(const char *filename, time_t mtime,
+        unsigned int sample_start, unsigned int sample_end, const short *data, int sample_count);
+
+void fluid_samplecache_set_persistent_funcs(fluid_samplecache_load_func_t load_func,
+        fluid_samplecache_store_func_t store_func);
+
 /* Only used for tests */
 int fluid_samplecache_count_entries(void);
 